@@ -6818,6 +6818,30 @@ std::vector<Term> Solver::getAssertions(void) const
   CVC5_API_TRY_CATCH_END;
 }
 
+void Solver::dumpPreprocessedAssertions(std::ostream& out) const
+{
+  CVC5_API_TRY_CATCH_BEGIN;
+  //////// all checks before this line
+  d_smtEngine->dumpPreprocessedAssertions(out);
+  ////////
+  CVC5_API_TRY_CATCH_END;
+}
+
+std::vector<Term> Solver::loadPreprocessedAssertions(std::istream& in)
+{
+  CVC5_API_TRY_CATCH_BEGIN;
+  //////// all checks before this line
+  std::vector<Node> decls = d_smtEngine->loadPreprocessedAssertions(in);
+  std::vector<Term> res;
+  for (const Node& d : decls)
+  {
+    res.push_back(Term(this, d));
+  }
+  return res;
+  ////////
+  CVC5_API_TRY_CATCH_END;
+}
+
 std::string Solver::getInfo(const std::string& flag) const
 {
   CVC5_API_TRY_CATCH_BEGIN;
@@ -7449,6 +7473,15 @@ Statistics Solver::getStatistics() const
   return Statistics(d_smtEngine->getStatisticsRegistry());
 }
 
+void Solver::printStatisticsSnapshot(std::ostream& out) const
+{
+  CVC5_API_TRY_CATCH_BEGIN;
+  //////// all checks before this line
+  d_smtEngine->printStatisticsSnapshot(out);
+  ////////
+  CVC5_API_TRY_CATCH_END;
+}
+
 }  // namespace api
 
 }  // namespace cvc5
@@ -3672,6 +3672,27 @@ class CVC5_EXPORT Solver
    */
   std::vector<Term> getAssertions() const;
 
+  /**
+   * Preprocess the current assertions and write them, together with the
+   * variables they contain and the substitutions of the variables eliminated
+   * by preprocessing, to out in a binary format that can be read by
+   * loadPreprocessedAssertions() of a solver of the same build of cvc5.
+   * Datatypes are not supported.
+   * @param out the output stream
+   */
+  void dumpPreprocessedAssertions(std::ostream& out) const;
+
+  /**
+   * Read assertions written by dumpPreprocessedAssertions() from in and
+   * assert them without preprocessing them again. The resulting assertions
+   * are equisatisfiable to the dumped ones. Not supported when proofs or
+   * unsat cores are enabled.
+   * @param in the input stream
+   * @return fresh constants that correspond to the free variables of the
+   *         dumped assertions, with the same names and sorts
+   */
+  std::vector<Term> loadPreprocessedAssertions(std::istream& in);
+
   /**
    * Get info from the solver.
    * SMT-LIB: \verbatim( get-info <info_flag> )\verbatim
@@ -4127,6 +4148,18 @@ class CVC5_EXPORT Solver
    */
   Statistics getStatistics() const;
 
+  /**
+   * Print the changes to the statistic values of this solver since the last
+   * call to this method as a single line of JSON. The line contains the
+   * wall-clock time in seconds (`time`), the time since the creation of the
+   * solver in milliseconds (`elapsed`), the number of satisfiability queries
+   * made so far (`query`) and an object (`stats`) that maps the name of every
+   * statistic that changed to its delta. Repeated calls produce a stream of
+   * JSON lines that can be used to monitor a long running solver.
+   * @param out the output stream
+   */
+  void printStatisticsSnapshot(std::ostream& out) const;
+
  private:
   /** @return the node manager of this solver */
   NodeManager* getNodeManager(void) const;
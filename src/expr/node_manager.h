@@ -53,6 +53,7 @@ namespace expr {
     class AttributeManager;
     }  // namespace attr
 
+  class NodeSerializer;
   class TypeChecker;
   }  // namespace expr
 
@@ -85,6 +86,7 @@ class NodeManagerListener {
 class NodeManager
 {
   friend class api::Solver;
+  friend class expr::NodeSerializer;
   friend class expr::NodeValue;
   friend class expr::TypeChecker;
   friend class SkolemManager;
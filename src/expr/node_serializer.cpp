@@ -0,0 +1,809 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2021 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Binary serialization of nodes.
+ */
+
+#include "expr/node_serializer.h"
+
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "base/exception.h"
+#include "expr/kind.h"
+#include "expr/node_builder.h"
+#include "expr/node_manager.h"
+#include "expr/node_manager_attributes.h"
+#include "expr/skolem_manager.h"
+#include "expr/type_checker.h"
+#include "util/bitvector.h"
+#include "util/divisible.h"
+#include "util/floatingpoint_size.h"
+#include "util/hash.h"
+#include "util/rational.h"
+#include "util/regexp.h"
+#include "util/roundingmode.h"
+#include "util/string.h"
+
+namespace cvc5 {
+namespace expr {
+
+namespace {
+
+/** The magic string at the beginning of the binary format */
+const char* s_magic = "cvc5-nodes";
+/** The version of the binary format */
+const uint64_t s_version = 1;
+
+/**
+ * A fingerprint of the kinds and type constants of this build, which must
+ * match for a serialization to be readable.
+ */
+uint64_t getKindsFingerprint()
+{
+  uint64_t hash = fnv1a::fnv1a_64(kind::LAST_KIND);
+  for (int32_t k = 0; k < kind::LAST_KIND; k++)
+  {
+    for (char c : kind::kindToString(static_cast<Kind>(k)))
+    {
+      hash = fnv1a::fnv1a_64(static_cast<uint8_t>(c), hash);
+    }
+  }
+  return fnv1a::fnv1a_64(LAST_TYPE, hash);
+}
+
+/** Whether rm is a valid rounding mode */
+bool isRoundingMode(uint64_t rm)
+{
+  switch (static_cast<RoundingMode>(rm))
+  {
+    case RoundingMode::ROUND_NEAREST_TIES_TO_EVEN:
+    case RoundingMode::ROUND_TOWARD_POSITIVE:
+    case RoundingMode::ROUND_TOWARD_NEGATIVE:
+    case RoundingMode::ROUND_TOWARD_ZERO:
+    case RoundingMode::ROUND_NEAREST_TIES_TO_AWAY: return true;
+    default: return false;
+  }
+}
+
+/** The tags of records in the binary format */
+enum class RecordTag : uint8_t
+{
+  TYPE = 0,
+  NODE = 1,
+  END = 2
+};
+
+class NodeWriter
+{
+ public:
+  NodeWriter(std::ostream& out) : d_out(out) {}
+
+  void writeHeader()
+  {
+    d_out.write(s_magic, std::strlen(s_magic));
+    writeUnsigned(s_version);
+    writeUnsigned(getKindsFingerprint());
+  }
+
+  /** Write the records for n and its subterms, return the identifier of n */
+  uint64_t writeNode(TNode n)
+  {
+    std::vector<TNode> visit;
+    visit.push_back(n);
+    do
+    {
+      TNode cur = visit.back();
+      if (d_nodeIds.find(cur) != d_nodeIds.end())
+      {
+        visit.pop_back();
+        continue;
+      }
+      kind::MetaKind mk = cur.getMetaKind();
+      if (mk == kind::metakind::VARIABLE)
+      {
+        writeVariable(cur);
+        visit.pop_back();
+        continue;
+      }
+      if (mk == kind::metakind::CONSTANT)
+      {
+        writeConstant(cur);
+        visit.pop_back();
+        continue;
+      }
+      if (mk == kind::metakind::NULLARY_OPERATOR)
+      {
+        uint64_t tid = writeType(cur.getType());
+        beginNode(cur);
+        writeUnsigned(tid);
+        visit.pop_back();
+        continue;
+      }
+      // write the operator and children first
+      bool ready = true;
+      if (mk == kind::metakind::PARAMETERIZED)
+      {
+        Node op = cur.getOperator();
+        if (d_nodeIds.find(op) == d_nodeIds.end())
+        {
+          ready = false;
+          visit.push_back(op);
+        }
+      }
+      for (const Node& cn : cur)
+      {
+        if (d_nodeIds.find(cn) == d_nodeIds.end())
+        {
+          ready = false;
+          visit.push_back(cn);
+        }
+      }
+      if (!ready)
+      {
+        continue;
+      }
+      beginNode(cur);
+      if (mk == kind::metakind::PARAMETERIZED)
+      {
+        writeUnsigned(d_nodeIds[cur.getOperator()]);
+      }
+      writeUnsigned(cur.getNumChildren());
+      for (const Node& cn : cur)
+      {
+        writeUnsigned(d_nodeIds[cn]);
+      }
+      visit.pop_back();
+    } while (!visit.empty());
+    return d_nodeIds[n];
+  }
+
+  void writeRoots(const std::vector<std::vector<uint64_t>>& lists)
+  {
+    d_out.put(static_cast<char>(RecordTag::END));
+    writeUnsigned(lists.size());
+    for (const std::vector<uint64_t>& ids : lists)
+    {
+      writeUnsigned(ids.size());
+      for (uint64_t id : ids)
+      {
+        writeUnsigned(id);
+      }
+    }
+  }
+
+ private:
+  void writeUnsigned(uint64_t v)
+  {
+    // little endian base 128, 7 bits per byte, high bit set if more follow
+    while (v >= 0x80)
+    {
+      d_out.put(static_cast<char>((v & 0x7f) | 0x80));
+      v >>= 7;
+    }
+    d_out.put(static_cast<char>(v));
+  }
+
+  void writeString(const std::string& s)
+  {
+    writeUnsigned(s.size());
+    d_out.write(s.data(), s.size());
+  }
+
+  /** Write the record for a node of kind k, which is given the next id */
+  void beginNode(TNode n)
+  {
+    d_out.put(static_cast<char>(RecordTag::NODE));
+    writeUnsigned(n.getKind());
+    uint64_t id = d_nodeIds.size();
+    d_nodeIds[n] = id;
+  }
+
+  /** Write the records for type tn and its component types */
+  uint64_t writeType(TypeNode tn)
+  {
+    std::unordered_map<TypeNode, uint64_t>::iterator it = d_typeIds.find(tn);
+    if (it != d_typeIds.end())
+    {
+      return it->second;
+    }
+    Kind k = tn.getKind();
+    std::vector<uint64_t> cids;
+    switch (k)
+    {
+      case kind::TYPE_CONSTANT:
+      case kind::BITVECTOR_TYPE:
+      case kind::FLOATINGPOINT_TYPE:
+      case kind::SORT_TYPE: break;
+      case kind::FUNCTION_TYPE:
+      case kind::ARRAY_TYPE:
+      case kind::SET_TYPE:
+      case kind::SEQUENCE_TYPE:
+      case kind::BAG_TYPE:
+        for (const TypeNode& ctn : tn)
+        {
+          cids.push_back(writeType(ctn));
+        }
+        break;
+      default:
+      {
+        std::stringstream ss;
+        ss << "Cannot serialize type " << tn;
+        throw Exception(ss.str());
+      }
+    }
+    d_out.put(static_cast<char>(RecordTag::TYPE));
+    writeUnsigned(k);
+    switch (k)
+    {
+      case kind::TYPE_CONSTANT:
+        writeUnsigned(tn.getConst<TypeConstant>());
+        break;
+      case kind::BITVECTOR_TYPE: writeUnsigned(tn.getBitVectorSize()); break;
+      case kind::FLOATINGPOINT_TYPE:
+        writeUnsigned(tn.getFloatingPointExponentSize());
+        writeUnsigned(tn.getFloatingPointSignificandSize());
+        break;
+      case kind::SORT_TYPE:
+        if (tn.getNumChildren() > 0)
+        {
+          std::stringstream ss;
+          ss << "Cannot serialize parametric sort " << tn;
+          throw Exception(ss.str());
+        }
+        writeString(tn.getAttribute(VarNameAttr()));
+        break;
+      default:
+        writeUnsigned(cids.size());
+        for (uint64_t cid : cids)
+        {
+          writeUnsigned(cid);
+        }
+        break;
+    }
+    uint64_t id = d_typeIds.size();
+    d_typeIds[tn] = id;
+    return id;
+  }
+
+  void writeVariable(TNode n)
+  {
+    Kind k = n.getKind();
+    if (k != kind::VARIABLE && k != kind::SKOLEM && k != kind::BOUND_VARIABLE)
+    {
+      std::stringstream ss;
+      ss << "Cannot serialize variable " << n << " of kind " << k;
+      throw Exception(ss.str());
+    }
+    uint64_t tid = writeType(n.getType());
+    beginNode(n);
+    writeUnsigned(tid);
+    std::string name;
+    n.getAttribute(VarNameAttr(), name);
+    writeString(name);
+  }
+
+  void writeConstant(TNode n)
+  {
+    Kind k = n.getKind();
+    switch (k)
+    {
+      case kind::CONST_BOOLEAN:
+        beginNode(n);
+        writeUnsigned(n.getConst<bool>() ? 1 : 0);
+        break;
+      case kind::CONST_RATIONAL:
+        beginNode(n);
+        writeString(n.getConst<Rational>().toString());
+        break;
+      case kind::CONST_BITVECTOR:
+      {
+        const BitVector& bv = n.getConst<BitVector>();
+        beginNode(n);
+        writeUnsigned(bv.getSize());
+        writeString(bv.getValue().toString(16));
+        break;
+      }
+      case kind::CONST_STRING:
+      {
+        const std::vector<unsigned>& vec = n.getConst<String>().getVec();
+        beginNode(n);
+        writeUnsigned(vec.size());
+        for (unsigned c : vec)
+        {
+          writeUnsigned(c);
+        }
+        break;
+      }
+      case kind::CONST_ROUNDINGMODE:
+        beginNode(n);
+        writeUnsigned(static_cast<uint64_t>(n.getConst<RoundingMode>()));
+        break;
+      case kind::BITVECTOR_EXTRACT_OP:
+      {
+        const BitVectorExtract& e = n.getConst<BitVectorExtract>();
+        beginNode(n);
+        writeUnsigned(e.d_high);
+        writeUnsigned(e.d_low);
+        break;
+      }
+      case kind::BITVECTOR_BITOF_OP:
+        beginNode(n);
+        writeUnsigned(n.getConst<BitVectorBitOf>().d_bitIndex);
+        break;
+      case kind::BITVECTOR_REPEAT_OP:
+        beginNode(n);
+        writeUnsigned(n.getConst<BitVectorRepeat>().d_repeatAmount);
+        break;
+      case kind::BITVECTOR_ROTATE_LEFT_OP:
+        beginNode(n);
+        writeUnsigned(n.getConst<BitVectorRotateLeft>().d_rotateLeftAmount);
+        break;
+      case kind::BITVECTOR_ROTATE_RIGHT_OP:
+        beginNode(n);
+        writeUnsigned(n.getConst<BitVectorRotateRight>().d_rotateRightAmount);
+        break;
+      case kind::BITVECTOR_SIGN_EXTEND_OP:
+        beginNode(n);
+        writeUnsigned(n.getConst<BitVectorSignExtend>().d_signExtendAmount);
+        break;
+      case kind::BITVECTOR_ZERO_EXTEND_OP:
+        beginNode(n);
+        writeUnsigned(n.getConst<BitVectorZeroExtend>().d_zeroExtendAmount);
+        break;
+      case kind::INT_TO_BITVECTOR_OP:
+        beginNode(n);
+        writeUnsigned(n.getConst<IntToBitVector>().d_size);
+        break;
+      case kind::DIVISIBLE_OP:
+        beginNode(n);
+        writeString(n.getConst<Divisible>().k.toString());
+        break;
+      case kind::REGEXP_REPEAT_OP:
+        beginNode(n);
+        writeUnsigned(n.getConst<RegExpRepeat>().d_repeatAmount);
+        break;
+      case kind::REGEXP_LOOP_OP:
+      {
+        const RegExpLoop& l = n.getConst<RegExpLoop>();
+        beginNode(n);
+        writeUnsigned(l.d_loopMinOcc);
+        writeUnsigned(l.d_loopMaxOcc);
+        break;
+      }
+      default:
+      {
+        std::stringstream ss;
+        ss << "Cannot serialize constant " << n << " of kind " << k;
+        throw Exception(ss.str());
+      }
+    }
+  }
+
+  /** The output stream */
+  std::ostream& d_out;
+  /** Identifiers of the types written so far */
+  std::unordered_map<TypeNode, uint64_t> d_typeIds;
+  /** Identifiers of the nodes written so far */
+  std::unordered_map<TNode, uint64_t> d_nodeIds;
+};
+
+}  // namespace
+
+/** Reads and validates the records of the binary format */
+class NodeSerializer::Reader
+{
+ public:
+  Reader(std::istream& in) : d_in(in), d_nm(NodeManager::currentNM()) {}
+
+  void readHeader()
+  {
+    size_t len = std::strlen(s_magic);
+    std::string magic(len, '\0');
+    d_in.read(&magic[0], len);
+    if (!d_in || magic != s_magic)
+    {
+      fail("not a serialized list of nodes");
+    }
+    if (readUnsigned() != s_version)
+    {
+      fail("unsupported version");
+    }
+    if (readUnsigned() != getKindsFingerprint())
+    {
+      fail("written by an incompatible build of cvc5");
+    }
+  }
+
+  std::vector<std::vector<Node>> readAll()
+  {
+    for (;;)
+    {
+      int tag = d_in.get();
+      if (!d_in)
+      {
+        fail("unexpected end of input");
+      }
+      switch (static_cast<RecordTag>(tag))
+      {
+        case RecordTag::TYPE: d_types.push_back(readType()); break;
+        case RecordTag::NODE: d_nodes.push_back(readNode()); break;
+        case RecordTag::END:
+        {
+          std::vector<std::vector<Node>> lists;
+          uint64_t nlists = readUnsigned();
+          for (uint64_t i = 0; i < nlists; i++)
+          {
+            lists.emplace_back();
+            uint64_t nroots = readUnsigned();
+            for (uint64_t j = 0; j < nroots; j++)
+            {
+              lists.back().push_back(getNode(readUnsigned()));
+            }
+          }
+          return lists;
+        }
+        default: fail("unknown record");
+      }
+    }
+  }
+
+ private:
+  [[noreturn]] void fail(const std::string& msg)
+  {
+    std::stringstream ss;
+    ss << "Cannot read serialized nodes: " << msg;
+    throw Exception(ss.str());
+  }
+
+  uint64_t readUnsigned()
+  {
+    uint64_t v = 0;
+    for (uint32_t shift = 0; shift < 64; shift += 7)
+    {
+      int b = d_in.get();
+      if (!d_in)
+      {
+        fail("unexpected end of input");
+      }
+      v |= static_cast<uint64_t>(b & 0x7f) << shift;
+      if ((b & 0x80) == 0)
+      {
+        return v;
+      }
+    }
+    fail("malformed integer");
+  }
+
+  uint32_t readUnsigned32()
+  {
+    uint64_t v = readUnsigned();
+    if (v > std::numeric_limits<uint32_t>::max())
+    {
+      fail("integer out of range");
+    }
+    return static_cast<uint32_t>(v);
+  }
+
+  std::string readString()
+  {
+    uint64_t len = readUnsigned();
+    std::string s;
+    // read in chunks to not trust a malformed length with an allocation
+    char buf[4096];
+    while (len > 0)
+    {
+      size_t n = len < sizeof(buf) ? len : sizeof(buf);
+      d_in.read(buf, n);
+      if (!d_in)
+      {
+        fail("unexpected end of input");
+      }
+      s.append(buf, n);
+      len -= n;
+    }
+    return s;
+  }
+
+  Kind readKind()
+  {
+    uint64_t k = readUnsigned();
+    if (k >= kind::LAST_KIND)
+    {
+      fail("unknown kind");
+    }
+    return static_cast<Kind>(k);
+  }
+
+  const TypeNode& getType(uint64_t id)
+  {
+    if (id >= d_types.size())
+    {
+      fail("reference to an unknown type");
+    }
+    return d_types[id];
+  }
+
+  const Node& getNode(uint64_t id)
+  {
+    if (id >= d_nodes.size())
+    {
+      fail("reference to an unknown node");
+    }
+    return d_nodes[id];
+  }
+
+  TypeNode readType()
+  {
+    Kind k = readKind();
+    switch (k)
+    {
+      case kind::TYPE_CONSTANT:
+      {
+        uint64_t tc = readUnsigned();
+        if (tc >= LAST_TYPE)
+        {
+          fail("unknown type constant");
+        }
+        return d_nm->mkTypeConst(static_cast<TypeConstant>(tc));
+      }
+      case kind::BITVECTOR_TYPE:
+      {
+        uint32_t size = readUnsigned32();
+        if (size == 0)
+        {
+          fail("bit-vector type of size zero");
+        }
+        return d_nm->mkBitVectorType(size);
+      }
+      case kind::FLOATINGPOINT_TYPE:
+      {
+        uint32_t exp = readUnsigned32();
+        uint32_t sig = readUnsigned32();
+        if (!validExponentSize(exp) || !validSignificandSize(sig))
+        {
+          fail("invalid floating-point type");
+        }
+        return d_nm->mkFloatingPointType(exp, sig);
+      }
+      case kind::SORT_TYPE: return d_nm->mkSort(readString());
+      case kind::FUNCTION_TYPE:
+      case kind::ARRAY_TYPE:
+      case kind::SET_TYPE:
+      case kind::SEQUENCE_TYPE:
+      case kind::BAG_TYPE: break;
+      default: fail("unsupported type");
+    }
+    std::vector<TypeNode> children;
+    uint64_t nchildren = readUnsigned();
+    for (uint64_t i = 0; i < nchildren; i++)
+    {
+      const TypeNode& ctn = getType(readUnsigned());
+      if (!ctn.isFirstClass())
+      {
+        fail("component type is not first-class");
+      }
+      children.push_back(ctn);
+    }
+    uint64_t expected = k == kind::ARRAY_TYPE ? 2 : 1;
+    if (k == kind::FUNCTION_TYPE ? nchildren < 2 : nchildren != expected)
+    {
+      fail("wrong number of component types");
+    }
+    return d_nm->mkTypeNode(k, children);
+  }
+
+  Node readNode()
+  {
+    Kind k = readKind();
+    kind::MetaKind mk = kind::metaKindOf(k);
+    switch (mk)
+    {
+      case kind::metakind::VARIABLE:
+      {
+        TypeNode tn = getType(readUnsigned());
+        std::string name = readString();
+        switch (k)
+        {
+          case kind::VARIABLE: return NodeSerializer::mkVar(name, tn);
+          case kind::SKOLEM:
+            return d_nm->getSkolemManager()->mkDummySkolem(
+                name, tn, "", NodeManager::SKOLEM_EXACT_NAME);
+          case kind::BOUND_VARIABLE: return d_nm->mkBoundVar(name, tn);
+          default: fail("unsupported variable");
+        }
+      }
+      case kind::metakind::CONSTANT: return readConstant(k);
+      case kind::metakind::INVALID: fail("unsupported kind");
+      default: break;
+    }
+    if (!TypeChecker::hasTypeRule(k))
+    {
+      fail("unsupported kind");
+    }
+    if (mk == kind::metakind::NULLARY_OPERATOR)
+    {
+      TypeNode tn = getType(readUnsigned());
+      return checkType(d_nm->mkNullaryOperator(tn, k));
+    }
+    NodeBuilder nb(d_nm, k);
+    if (mk == kind::metakind::PARAMETERIZED)
+    {
+      const Node& op = getNode(readUnsigned());
+      if (op.getMetaKind() == kind::metakind::CONSTANT
+              ? NodeManager::operatorToKind(op) != k
+              : k != kind::APPLY_UF)
+      {
+        fail("wrong operator");
+      }
+      nb << op;
+    }
+    uint64_t nchildren = readUnsigned();
+    if (nchildren < kind::metakind::getMinArityForKind(k)
+        || nchildren > kind::metakind::getMaxArityForKind(k))
+    {
+      fail("wrong number of children");
+    }
+    for (uint64_t i = 0; i < nchildren; i++)
+    {
+      nb << getNode(readUnsigned());
+    }
+    return checkType(nb.constructNode());
+  }
+
+  /** Return n if it is well-typed, fail otherwise */
+  Node checkType(Node n)
+  {
+    try
+    {
+      n.getType(true);
+    }
+    catch (const TypeCheckingExceptionPrivate& e)
+    {
+      fail(e.getMessage());
+    }
+    return n;
+  }
+
+  Node readConstant(Kind k)
+  {
+    switch (k)
+    {
+      case kind::CONST_BOOLEAN: return d_nm->mkConst(readUnsigned() != 0);
+      case kind::CONST_RATIONAL: return d_nm->mkConst(Rational(readString()));
+      case kind::CONST_BITVECTOR:
+      {
+        uint32_t size = readUnsigned32();
+        if (size == 0)
+        {
+          fail("bit-vector constant of size zero");
+        }
+        return d_nm->mkConst(BitVector(size, Integer(readString(), 16)));
+      }
+      case kind::CONST_STRING:
+      {
+        std::vector<unsigned> vec;
+        uint64_t len = readUnsigned();
+        for (uint64_t i = 0; i < len; i++)
+        {
+          uint32_t c = readUnsigned32();
+          if (c >= String::num_codes())
+          {
+            fail("invalid character in string constant");
+          }
+          vec.push_back(c);
+        }
+        return d_nm->mkConst(String(vec));
+      }
+      case kind::CONST_ROUNDINGMODE:
+      {
+        uint64_t rm = readUnsigned();
+        if (!isRoundingMode(rm))
+        {
+          fail("invalid rounding mode");
+        }
+        return d_nm->mkConst(static_cast<RoundingMode>(rm));
+      }
+      case kind::BITVECTOR_EXTRACT_OP:
+      {
+        uint32_t high = readUnsigned32();
+        uint32_t low = readUnsigned32();
+        return d_nm->mkConst(BitVectorExtract(high, low));
+      }
+      case kind::BITVECTOR_BITOF_OP:
+        return d_nm->mkConst(BitVectorBitOf(readUnsigned32()));
+      case kind::BITVECTOR_REPEAT_OP:
+        return d_nm->mkConst(BitVectorRepeat(readUnsigned32()));
+      case kind::BITVECTOR_ROTATE_LEFT_OP:
+        return d_nm->mkConst(BitVectorRotateLeft(readUnsigned32()));
+      case kind::BITVECTOR_ROTATE_RIGHT_OP:
+        return d_nm->mkConst(BitVectorRotateRight(readUnsigned32()));
+      case kind::BITVECTOR_SIGN_EXTEND_OP:
+        return d_nm->mkConst(BitVectorSignExtend(readUnsigned32()));
+      case kind::BITVECTOR_ZERO_EXTEND_OP:
+        return d_nm->mkConst(BitVectorZeroExtend(readUnsigned32()));
+      case kind::INT_TO_BITVECTOR_OP:
+        return d_nm->mkConst(IntToBitVector(readUnsigned32()));
+      case kind::DIVISIBLE_OP:
+      {
+        Integer n(readString());
+        if (n.sgn() <= 0)
+        {
+          fail("divisibility by a non-positive integer");
+        }
+        return d_nm->mkConst(Divisible(n));
+      }
+      case kind::REGEXP_REPEAT_OP:
+        return d_nm->mkConst(RegExpRepeat(readUnsigned32()));
+      case kind::REGEXP_LOOP_OP:
+      {
+        uint32_t min = readUnsigned32();
+        uint32_t max = readUnsigned32();
+        return d_nm->mkConst(RegExpLoop(min, max));
+      }
+      default: fail("unsupported constant");
+    }
+  }
+
+  /** The input stream */
+  std::istream& d_in;
+  /** The node manager */
+  NodeManager* d_nm;
+  /** The types read so far, indexed by their identifier */
+  std::vector<TypeNode> d_types;
+  /** The nodes read so far, indexed by their identifier */
+  std::vector<Node> d_nodes;
+};
+
+void NodeSerializer::write(std::ostream& out,
+                           const std::vector<std::vector<Node>>& lists)
+{
+  NodeWriter nw(out);
+  nw.writeHeader();
+  std::vector<std::vector<uint64_t>> ids;
+  for (const std::vector<Node>& nodes : lists)
+  {
+    ids.emplace_back();
+    for (const Node& n : nodes)
+    {
+      ids.back().push_back(nw.writeNode(n));
+    }
+  }
+  nw.writeRoots(ids);
+}
+
+std::vector<std::vector<Node>> NodeSerializer::read(std::istream& in)
+{
+  Reader r(in);
+  try
+  {
+    r.readHeader();
+    return r.readAll();
+  }
+  catch (const std::invalid_argument& e)
+  {
+    // malformed numerals in rational or integer constants
+    std::stringstream ss;
+    ss << "Cannot read serialized nodes: " << e.what();
+    throw Exception(ss.str());
+  }
+}
+
+Node NodeSerializer::mkVar(const std::string& name, const TypeNode& type)
+{
+  return NodeManager::currentNM()->mkVar(name, type);
+}
+
+}  // namespace expr
+}  // namespace cvc5
@@ -0,0 +1,74 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2021 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Binary serialization of nodes.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__EXPR__NODE_SERIALIZER_H
+#define CVC5__EXPR__NODE_SERIALIZER_H
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "expr/node.h"
+
+namespace cvc5 {
+namespace expr {
+
+/**
+ * Utility for writing lists of nodes (e.g. the declarations, substitutions
+ * and assertions of a preprocessed problem) to a compact binary format, and
+ * for reading them back.
+ *
+ * Each distinct type and each distinct term is written exactly once, also
+ * across lists, hence DAG sharing is preserved and the size of the output is
+ * linear in the DAG size of the input. Children are written before their
+ * parents, so that reading is a single pass in which each node is built from
+ * nodes that were already read, without any parsing or symbol resolution.
+ *
+ * Reading reconstructs free variables as fresh variables, skolems as fresh
+ * skolems and bound variables as fresh bound variables, each with the same
+ * name and type, and uninterpreted sorts as fresh sorts with the same name.
+ * Since kinds are written by their internal number, the format is only
+ * readable by a build of cvc5 with the same kinds, which is checked when
+ * reading. The input is validated while reading: every node is checked for
+ * its arity, its operator and its type before it is used by other nodes.
+ *
+ * Supported constants are Booleans, rationals, bit-vectors, strings, rounding
+ * modes and the indexed operators of bit-vectors, regular expressions and
+ * divisibility. Datatypes and other constants are not supported.
+ */
+class NodeSerializer
+{
+ public:
+  /**
+   * Write lists of nodes to out. Throws an Exception if the nodes contain a
+   * type, variable or constant that is not supported.
+   */
+  static void write(std::ostream& out,
+                    const std::vector<std::vector<Node>>& lists);
+  /**
+   * Read lists of nodes written by write from in. Throws an Exception if in
+   * is not in the expected format.
+   */
+  static std::vector<std::vector<Node>> read(std::istream& in);
+
+ private:
+  class Reader;
+  /** Make a free variable, which only the NodeManager may do */
+  static Node mkVar(const std::string& name, const TypeNode& type);
+};
+
+}  // namespace expr
+}  // namespace cvc5
+
+#endif /* CVC5__EXPR__NODE_SERIALIZER_H */
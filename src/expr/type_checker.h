@@ -32,6 +32,9 @@ public:
 
  static bool computeIsConst(NodeManager* nodeManager, TNode n);
 
+ /** Return true if computeType can compute the type of nodes of kind k. */
+ static bool hasTypeRule(Kind k);
+
 };/* class TypeChecker */
 
 }  // namespace expr
@@ -59,6 +59,22 @@ ${typerules}
 
 }/* TypeChecker::computeType */
 
+bool TypeChecker::hasTypeRule(Kind k)
+{
+  switch (k)
+  {
+    case kind::VARIABLE:
+    case kind::SKOLEM:
+    case kind::BUILTIN:
+      // clang-format off
+${typerulekinds}
+      // clang-format on
+      return true;
+    default:;
+  }
+  return false;
+}/* TypeChecker::hasTypeRule */
+
 bool TypeChecker::computeIsConst(NodeManager* nodeManager, TNode n)
 {
   Assert(n.getMetaKind() == kind::metakind::OPERATOR
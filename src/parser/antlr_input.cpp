@@ -16,7 +16,13 @@
 #include "parser/antlr_input.h"
 
 #include <antlr3.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <istream>
 #include <limits>
+#include <streambuf>
 
 #include "base/check.h"
 #include "base/output.h"
@@ -40,6 +46,37 @@ using namespace cvc5::kind;
 namespace cvc5 {
 namespace parser {
 
+namespace {
+
+/**
+ * A read-only stream over a character array that it neither owns nor copies.
+ * The array must outlive the stream.
+ */
+class CharArrayStream : public std::istream
+{
+  class Buffer : public std::streambuf
+  {
+   public:
+    Buffer(const char* data, size_t size)
+    {
+      char* begin = const_cast<char*>(data);
+      setg(begin, begin, begin + size);
+    }
+  };
+
+ public:
+  CharArrayStream(const char* data, size_t size)
+      : std::istream(nullptr), d_buffer(data, size)
+  {
+    rdbuf(&d_buffer);
+  }
+
+ private:
+  Buffer d_buffer;
+};
+
+}  // namespace
+
 // These functions exactly wrap the antlr3 source inconsistencies.
 // These are the only location CVC5_ANTLR3_OLD_INPUT_STREAM ifdefs appear.
 // No other sanity checking happens;
@@ -110,7 +147,8 @@ AntlrInputStream::AntlrInputStream(std::string name, pANTLR3_INPUT_STREAM input,
     : InputStream(name, fileIsTemporary),
       d_input(input),
       d_inputString(inputString),
-      d_line_buffer(line_buffer) {
+      d_line_buffer(line_buffer),
+      d_stream(NULL) {
   Assert(input != NULL);
   input->fileName = input->strFactory->newStr8(input->strFactory, (pANTLR3_UINT8)name.c_str());
 }
@@ -123,6 +161,10 @@ AntlrInputStream::~AntlrInputStream() {
   if (d_line_buffer != NULL) {
     delete d_line_buffer;
   }
+  // the line buffer reads from the stream, hence it is deleted last
+  if (d_stream != NULL) {
+    delete d_stream;
+  }
 }
 
 pANTLR3_INPUT_STREAM AntlrInputStream::getAntlr3InputStream() const {
@@ -140,6 +182,29 @@ AntlrInputStream::newFileInputStream(const std::string& name,
     useMmap = false;
   }
 #endif
+  struct stat st;
+  if (stat(name.c_str(), &st) != 0 || !S_ISREG(st.st_mode))
+  {
+    // only regular files can be memory mapped, e.g. named pipes report a size
+    // of zero and must be read
+    useMmap = false;
+  }
+  // ANTLR3 input streams that hold the whole file store its size in 32 bits,
+  // hence larger files would be silently truncated. We read them line by line
+  // instead, as streams are.
+  else if (static_cast<uint64_t>(st.st_size)
+           > std::numeric_limits<uint32_t>::max())
+  {
+    std::ifstream* file = new std::ifstream(name);
+    if (!file->is_open())
+    {
+      delete file;
+      throw InputStreamException("Couldn't open file: " + name);
+    }
+    AntlrInputStream* stream = newStreamInputStream(*file, name);
+    stream->d_stream = file;
+    return stream;
+  }
   pANTLR3_INPUT_STREAM input = NULL;
   if(useMmap) {
     input = MemoryMappedInputBufferNew(name);
@@ -169,7 +234,15 @@ AntlrInputStream::newStringInputStream(const std::string& input,
                                        const std::string& name)
 {
   size_t input_size = input.size();
-  Assert(input_size <= std::numeric_limits<uint32_t>::max());
+  if (input_size > std::numeric_limits<uint32_t>::max())
+  {
+    // too large for an in-place ANTLR3 input stream, see newFileInputStream,
+    // the lines are read from the string itself to avoid copying it
+    CharArrayStream* array = new CharArrayStream(input.data(), input_size);
+    AntlrInputStream* stream = newStreamInputStream(*array, name);
+    stream->d_stream = array;
+    return stream;
+  }
 
   // Ownership of input_duplicate  is transferred to the AntlrInputStream.
   pANTLR3_UINT8 input_duplicate = (pANTLR3_UINT8) strdup(input.c_str());
@@ -261,6 +334,33 @@ AntlrInput::~AntlrInput() {
   BoundedTokenBufferFree(d_tokenBuffer);
 }
 
+void AntlrInput::releaseParsedInput()
+{
+  LineBuffer* lineBuffer =
+      static_cast<AntlrInputStream*>(getInputStream())->getLineBuffer();
+  if (lineBuffer == NULL)
+  {
+    return;
+  }
+  // Tokens point into the lines they were read from. The parser may still
+  // look back at up to k consumed tokens and look at the tokens that were
+  // read ahead, hence we keep the lines from the first of them on.
+  size_t line = d_antlr3InputStream->line;
+  if (d_tokenBuffer != NULL && !d_tokenBuffer->empty)
+  {
+    ANTLR3_UINT32 first = d_tokenBuffer->currentIndex > d_tokenBuffer->k
+                              ? d_tokenBuffer->currentIndex - d_tokenBuffer->k
+                              : 0;
+    for (ANTLR3_UINT32 i = first; i <= d_tokenBuffer->maxIndex; ++i)
+    {
+      pANTLR3_COMMON_TOKEN token =
+          d_tokenBuffer->tokenBuffer[i % d_tokenBuffer->bufferSize];
+      line = std::min(line, static_cast<size_t>(token->getLine(token)));
+    }
+  }
+  lineBuffer->releaseBefore(line);
+}
+
 pANTLR3_COMMON_TOKEN_STREAM AntlrInput::getTokenStream() {
   return d_tokenBuffer->commonTstream;
 }
@@ -18,6 +18,7 @@
 
 #include <antlr3.h>
 
+#include <fstream>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
@@ -50,6 +51,12 @@ private:
 
   LineBuffer* d_line_buffer;
 
+  /**
+   * The stream read by d_line_buffer, if it is owned by this input stream. It
+   * is otherwise NULL.
+   */
+  std::istream* d_stream;
+
   AntlrInputStream(std::string name, pANTLR3_INPUT_STREAM input,
                    bool fileIsTemporary, pANTLR3_UINT8 inputString,
                    LineBuffer* line_buffer);
@@ -66,7 +73,13 @@ public:
 
   pANTLR3_INPUT_STREAM getAntlr3InputStream() const;
 
+  /** The line buffer of a line-buffered input, or NULL otherwise. */
+  LineBuffer* getLineBuffer() const { return d_line_buffer; }
+
   /** Create a file input.
+   *
+   * Files whose size does not fit the 32-bit buffer size of ANTLR3 are read
+   * line by line, as streams are.
    *
    * @param name the path of the file to read
    * @param useMmap <code>true</code> if the input should use memory-mapped I/O; otherwise, the
@@ -81,7 +94,9 @@ public:
 
   /** Create a string input.
    * NOTE: the new AntlrInputStream will take ownership of input over
-   * and free it at destruction time.
+   * and free it at destruction time. As for files, strings whose size does not
+   * fit in 32 bits are read line by line. Such strings are read in place, not
+   * copied, hence they must outlive the AntlrInputStream.
    *
    * @param input the string to read
    * @param name the "filename" to use when reporting errors
@@ -202,6 +217,12 @@ protected:
    */
   void parseError(const std::string& msg, bool eofException = false) override;
 
+  /**
+   * Frees the lines of a line-buffered input that no buffered token starts
+   * in anymore.
+   */
+  void releaseParsedInput() override;
+
   /** Set the ANTLR3 lexer for this input. */
   void setAntlr3Lexer(pANTLR3_LEXER pLexer);
 
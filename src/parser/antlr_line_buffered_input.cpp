@@ -18,7 +18,8 @@
  * This overwrites the _LA and the consume functions of the ANTLR input stream
  * to use a LineBuffer instead of accessing a buffer. The lines are kept in
  * memory to make sure that existing tokens remain valid (tokens store pointers
- * to the corresponding input). We do not overwrite mark(), etc. because
+ * to the corresponding input), until AntlrInput::releaseParsedInput() frees
+ * the lines that no buffered token starts in after a command. We do not overwrite mark(), etc. because
  * we can use the line number and the position within that line to index into
  * the line buffer and the default markers already store and restore that
  * information. The line buffer guarantees that lines are consecutive in
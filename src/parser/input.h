@@ -150,6 +150,12 @@ class CVC5_EXPORT Input
    */
   virtual Command* parseCommand() = 0;
 
+  /**
+   * Frees the buffered input that the commands parsed so far were read from,
+   * if the input is read incrementally. Called after each command.
+   */
+  virtual void releaseParsedInput() {}
+
   /**
    * Issue a warning to the user, with source file, line, and column info.
    */
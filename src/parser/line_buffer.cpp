@@ -29,7 +29,9 @@
 namespace cvc5 {
 namespace parser {
 
-LineBuffer::LineBuffer(std::istream* stream) : d_stream(stream) {}
+LineBuffer::LineBuffer(std::istream* stream) : d_stream(stream), d_firstLine(0)
+{
+}
 
 LineBuffer::~LineBuffer() {
   for (size_t i = 0; i < d_lines.size(); i++) {
@@ -41,6 +43,8 @@ uint8_t* LineBuffer::getPtr(size_t line, size_t pos_in_line) {
   if (!readToLine(line)) {
     return NULL;
   }
+  Assert(line >= d_firstLine);
+  line -= d_firstLine;
   Assert(pos_in_line < d_sizes[line]);
   return d_lines[line] + pos_in_line;
 }
@@ -50,22 +54,27 @@ uint8_t* LineBuffer::getPtrWithOffset(size_t line, size_t pos_in_line,
   if (!readToLine(line)) {
     return NULL;
   }
-  if (pos_in_line + offset >= d_sizes[line]) {
+  Assert(line >= d_firstLine);
+  size_t i = line - d_firstLine;
+  if (pos_in_line + offset >= d_sizes[i])
+  {
     return getPtrWithOffset(line + 1, 0,
-                            offset - (d_sizes[line] - pos_in_line - 1));
+                            offset - (d_sizes[i] - pos_in_line - 1));
   }
-  Assert(pos_in_line + offset < d_sizes[line]);
-  return d_lines[line] + pos_in_line + offset;
+  Assert(pos_in_line + offset < d_sizes[i]);
+  return d_lines[i] + pos_in_line + offset;
 }
 
 bool LineBuffer::isPtrBefore(uint8_t* ptr, size_t line, size_t pos_in_line) {
-  for (size_t j = 0; j < line; j++)
+  Assert(line >= d_firstLine);
+  size_t last = line - d_firstLine;
+  for (size_t j = 0; j <= last; j++)
   {
     // NOTE: std::less is guaranteed to give consistent results when comparing
     // pointers of different arrays (in contrast to built-in comparison
     // operators).
-    size_t i = line - j;
-    uint8_t* end = d_lines[i] + ((i == line) ? pos_in_line : d_sizes[i]);
+    size_t i = last - j;
+    uint8_t* end = d_lines[i] + ((i == last) ? pos_in_line : d_sizes[i]);
     if (std::less<uint8_t*>()(d_lines[i] - 1, ptr) &&
         std::less<uint8_t*>()(ptr, end)) {
       return true;
@@ -76,7 +85,7 @@ bool LineBuffer::isPtrBefore(uint8_t* ptr, size_t line, size_t pos_in_line) {
 
 bool LineBuffer::readToLine(size_t line_size)
 {
-  while (line_size >= d_lines.size())
+  while (line_size >= d_firstLine + d_lines.size())
   {
     if (!(*d_stream)) {
       return false;
@@ -93,5 +102,16 @@ bool LineBuffer::readToLine(size_t line_size)
   return true;
 }
 
+void LineBuffer::releaseBefore(size_t line)
+{
+  while (d_firstLine < line && !d_lines.empty())
+  {
+    delete[] d_lines.front();
+    d_lines.pop_front();
+    d_sizes.pop_front();
+    d_firstLine++;
+  }
+}
+
 }  // namespace parser
 }  // namespace cvc5
@@ -23,8 +23,8 @@
 #define CVC5__PARSER__LINE_BUFFER_H
 
 #include <cstdlib>
+#include <deque>
 #include <istream>
-#include <vector>
 
 namespace cvc5 {
 namespace parser {
@@ -54,6 +54,13 @@ class LineBuffer {
     */
   bool isPtrBefore(uint8_t* ptr, size_t line, size_t pos_in_line);
 
+  /**
+    * Frees the lines before a given line number. The caller guarantees that
+    * the lexer and the parser no longer access them, e.g. because no token
+    * that is still buffered starts before that line.
+    */
+  void releaseBefore(size_t line);
+
  private:
   /**
     * Reads lines up to a line number from the input if needed (it does
@@ -63,12 +70,15 @@ class LineBuffer {
   bool readToLine(size_t line);
 
   std::istream* d_stream;
-  // Each element in this vector corresponds to a line from the input stream.
+  // Each element in this deque corresponds to a line from the input stream,
+  // starting with line d_firstLine.
   // WARNING: not null-terminated.
-  std::vector<uint8_t*> d_lines;
-  // Each element in this vector corresponds to the length of a line from the
-  // input stream.
-  std::vector<size_t> d_sizes;
+  std::deque<uint8_t*> d_lines;
+  // Each element in this deque corresponds to the length of a line from the
+  // input stream, starting with line d_firstLine.
+  std::deque<size_t> d_sizes;
+  // The number of the first line that has not been released.
+  size_t d_firstLine;
 };
 
 }  // namespace parser
@@ -23,6 +23,8 @@
 #ifndef _WIN32
 
 #include <cerrno>
+#include <cstdint>
+#include <limits>
 #include <sys/mman.h>
 #include <sys/stat.h>
 
@@ -101,7 +103,21 @@ static ANTLR3_UINT32 MemoryMapFile(pANTLR3_INPUT_STREAM input,
     return ANTLR3_ERR_NOFILE;
   }
 
+  // ANTLR3 stores the size of the buffer in 32 bits, larger files cannot be
+  // mapped without silently truncating them, AntlrInputStream reads them line
+  // by line instead
+  if (static_cast<uint64_t>(st.st_size)
+      > std::numeric_limits<ANTLR3_UINT32>::max())
+  {
+    return ANTLR3_ERR_NOMEM;
+  }
   input->sizeBuf = st.st_size;
+  if (input->sizeBuf == 0)
+  {
+    // mmap fails on empty mappings, an empty file is an empty buffer
+    input->data = const_cast<char*>("");
+    return ANTLR3_SUCCESS;
+  }
 
   int fd = open(filename.c_str(), O_RDONLY);
   if(fd == -1) {
@@ -114,6 +130,10 @@ static ANTLR3_UINT32 MemoryMapFile(pANTLR3_INPUT_STREAM input,
   if(intptr_t(input->data) == -1) {
     return ANTLR3_ERR_NOMEM;
   }
+  // The lexer reads the input front to back, tell the kernel so that it reads
+  // ahead aggressively and drops pages behind the lexer early. This is only a
+  // hint, hence we ignore failures.
+  madvise(input->data, input->sizeBuf, MADV_SEQUENTIAL);
 
   return ANTLR3_SUCCESS;
 }
@@ -122,7 +142,10 @@ static ANTLR3_UINT32 MemoryMapFile(pANTLR3_INPUT_STREAM input,
  * We need to unmap the file somewhere, so we install this function as free and
  * call the default version of close to de-allocate everything else. */
 void UnmapFile(pANTLR3_INPUT_STREAM input) {
-  munmap((void*) input->data, input->sizeBuf);
+  if (input->sizeBuf > 0)
+  {
+    munmap((void*)input->data, input->sizeBuf);
+  }
   input->close(input);
 }
 
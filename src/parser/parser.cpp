@@ -680,6 +680,7 @@ Command* Parser::nextCommand()
   } else {
     try {
       cmd = d_input->parseCommand();
+      d_input->releaseParsedInput();
       d_commandQueue.push_back(cmd);
       cmd = d_commandQueue.front();
       d_commandQueue.pop_front();
@@ -32,6 +32,7 @@ AssertionPipeline::AssertionPipeline()
       d_substsIndex(0),
       d_assumptionsStart(0),
       d_numAssumptions(0),
+      d_recordReplacedEnd(0),
       d_pppg(nullptr)
 {
 }
@@ -42,6 +43,8 @@ void AssertionPipeline::clear()
   d_realAssertionsEnd = 0;
   d_assumptionsStart = 0;
   d_numAssumptions = 0;
+  d_recordReplacedEnd = 0;
+  d_replaced.clear();
 }
 
 void AssertionPipeline::push_back(Node n,
@@ -103,6 +106,10 @@ void AssertionPipeline::replace(size_t i, Node n, ProofGenerator* pgen)
     d_pppg->notifyPreprocessed(d_nodes[i], n, pgen);
   }
   d_nodes[i] = n;
+  if (i < d_recordReplacedEnd)
+  {
+    d_replaced.insert(i);
+  }
 }
 
 void AssertionPipeline::replaceTrusted(size_t i, TrustNode trn)
@@ -117,6 +124,12 @@ void AssertionPipeline::replaceTrusted(size_t i, TrustNode trn)
   replace(i, trn.getNode(), trn.getGenerator());
 }
 
+void AssertionPipeline::startRecordingReplaced()
+{
+  d_recordReplacedEnd = d_nodes.size();
+  d_replaced.clear();
+}
+
 void AssertionPipeline::setProofGenerator(smt::PreprocessProofGenerator* pppg)
 {
   d_pppg = pppg;
@@ -200,6 +213,10 @@ void AssertionPipeline::conjoin(size_t i, Node n, ProofGenerator* pg)
     }
   }
   d_nodes[i] = newConjr;
+  if (i < d_recordReplacedEnd)
+  {
+    d_replaced.insert(i);
+  }
   Assert(theory::Rewriter::rewrite(newConjr) == newConjr);
 }
 
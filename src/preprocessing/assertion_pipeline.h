@@ -19,6 +19,7 @@
 #ifndef CVC5__PREPROCESSING__ASSERTION_PIPELINE_H
 #define CVC5__PREPROCESSING__ASSERTION_PIPELINE_H
 
+#include <unordered_set>
 #include <vector>
 
 #include "expr/node.h"
@@ -112,6 +113,19 @@ class AssertionPipeline
 
   void updateRealAssertionsEnd() { d_realAssertionsEnd = d_nodes.size(); }
 
+  /**
+   * Start recording which of the current assertions are replaced, see
+   * getNumReplaced.
+   */
+  void startRecordingReplaced();
+  /**
+   * @return The number of distinct assertions, among those present at the
+   * last call to startRecordingReplaced, that were replaced by a different
+   * one via the replace or conjoin methods since that call. An assertion that
+   * is replaced several times is counted once.
+   */
+  size_t getNumReplaced() const { return d_replaced.size(); }
+
   /**
    * Returns true if substitutions must be stored as assertions. This is for
    * example the case when we do incremental solving.
@@ -194,6 +208,10 @@ class AssertionPipeline
   size_t d_assumptionsStart;
   /** The number of assumptions */
   size_t d_numAssumptions;
+  /** The number of assertions whose replacement is recorded */
+  size_t d_recordReplacedEnd;
+  /** The indices of the replaced assertions, see getNumReplaced */
+  std::unordered_set<size_t> d_replaced;
   /** The proof generator, if one is provided */
   smt::PreprocessProofGenerator* d_pppg;
 }; /* class AssertionPipeline */
@@ -47,6 +47,12 @@ class Ackermann : public PreprocessingPass
  public:
   Ackermann(PreprocessingPassContext* preprocContext);
 
+  /**
+   * The functional consistency lemmas only cover the applications in the
+   * current assertions.
+   */
+  bool isIncrementalSafe() const override { return false; }
+
  protected:
   /**
    * Apply Ackermannization as follows:
@@ -38,6 +38,9 @@ class BvAbstraction : public PreprocessingPass
  public:
   BvAbstraction(PreprocessingPassContext* preprocContext);
 
+  /** The abstraction is computed from the current assertions only */
+  bool isIncrementalSafe() const override { return false; }
+
  protected:
   PreprocessingPassResult applyInternal(
       AssertionPipeline* assertionsToPreprocess) override;
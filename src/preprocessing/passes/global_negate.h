@@ -39,6 +39,9 @@ class GlobalNegate : public PreprocessingPass
  public:
   GlobalNegate(PreprocessingPassContext* preprocContext);
 
+  /** Negating the current assertions does not negate the whole problem */
+  bool isIncrementalSafe() const override { return false; }
+
  protected:
   PreprocessingPassResult applyInternal(
       AssertionPipeline* assertionsToPreprocess) override;
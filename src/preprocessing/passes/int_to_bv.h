@@ -35,6 +35,9 @@ class IntToBV : public PreprocessingPass
 {
  public:
   IntToBV(PreprocessingPassContext* preprocContext);
+
+  /** Later assertions may need integers that do not fit the bit-width */
+  bool isIncrementalSafe() const override { return false; }
   Node intToBV(TNode n, NodeMap& cache);
 
  protected:
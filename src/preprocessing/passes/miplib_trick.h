@@ -31,6 +31,9 @@ class MipLibTrick : public PreprocessingPass, public NodeManagerListener
   MipLibTrick(PreprocessingPassContext* preprocContext);
   ~MipLibTrick();
 
+  /** The trick relies on the Boolean variables of all assertions */
+  bool isIncrementalSafe() const override { return false; }
+
   // NodeManagerListener callbacks to collect d_boolVars.
   void nmNotifyNewVar(TNode n) override;
   void nmNotifyNewSkolem(TNode n,
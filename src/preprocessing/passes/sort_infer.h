@@ -32,6 +32,9 @@ class SortInferencePass : public PreprocessingPass
  public:
   SortInferencePass(PreprocessingPassContext* preprocContext);
 
+  /** Later assertions may equate terms of different inferred sorts */
+  bool isIncrementalSafe() const override { return false; }
+
  protected:
   PreprocessingPassResult applyInternal(
       AssertionPipeline* assertionsToPreprocess) override;
@@ -39,6 +39,9 @@ class SygusInference : public PreprocessingPass
  public:
   SygusInference(PreprocessingPassContext* preprocContext);
 
+  /** The current assertions are replaced by a single synthesis conjecture */
+  bool isIncrementalSafe() const override { return false; }
+
  protected:
   /**
    * Either replaces all uninterpreted functions in assertions by their
@@ -42,6 +42,12 @@ class UnconstrainedSimplifier : public PreprocessingPass
  public:
   UnconstrainedSimplifier(PreprocessingPassContext* preprocContext);
 
+  /**
+   * Whether a term is unconstrained depends on all assertions, including
+   * those asserted after this pass was applied.
+   */
+  bool isIncrementalSafe() const override { return false; }
+
   PreprocessingPassResult applyInternal(
       AssertionPipeline* assertionsToPreprocess) override;
 
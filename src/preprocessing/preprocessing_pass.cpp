@@ -15,6 +15,7 @@
 
 #include "preprocessing/preprocessing_pass.h"
 
+#include "options/base_options.h"
 #include "preprocessing/assertion_pipeline.h"
 #include "preprocessing/preprocessing_pass_context.h"
 #include "printer/printer.h"
@@ -33,7 +34,19 @@ PreprocessingPassResult PreprocessingPass::apply(
   Trace("preprocessing") << "PRE " << d_name << std::endl;
   Chat() << d_name << "..." << std::endl;
   dumpAssertions(("pre-" + d_name).c_str(), *assertionsToPreprocess);
+  Assert(!options::incrementalSolving() || isIncrementalSafe())
+      << d_name << " is not supported in incremental mode";
+  size_t prevSize = assertionsToPreprocess->size();
+  assertionsToPreprocess->startRecordingReplaced();
   PreprocessingPassResult result = applyInternal(assertionsToPreprocess);
+  d_numAssertions += prevSize;
+  d_numSkipped += d_numProcessed.get();
+  d_numRewritten += assertionsToPreprocess->getNumReplaced();
+  if (assertionsToPreprocess->size() > prevSize)
+  {
+    d_numAdded += assertionsToPreprocess->size() - prevSize;
+  }
+  d_numProcessed = d_numProcessed.get() + assertionsToPreprocess->size();
   dumpAssertions(("post-" + d_name).c_str(), *assertionsToPreprocess);
   Trace("preprocessing") << "POST " << d_name << std::endl;
   return result;
@@ -58,7 +71,16 @@ void PreprocessingPass::dumpAssertions(const char* key,
 PreprocessingPass::PreprocessingPass(PreprocessingPassContext* preprocContext,
                                      const std::string& name)
     : d_name(name),
-      d_timer(smtStatisticsRegistry().registerTimer("preprocessing::" + name))
+      d_timer(smtStatisticsRegistry().registerTimer("preprocessing::" + name)),
+      d_numAssertions(smtStatisticsRegistry().registerInt(
+          "preprocessing::" + name + "::assertions")),
+      d_numSkipped(smtStatisticsRegistry().registerInt(
+          "preprocessing::" + name + "::skipped")),
+      d_numRewritten(smtStatisticsRegistry().registerInt(
+          "preprocessing::" + name + "::rewritten")),
+      d_numAdded(smtStatisticsRegistry().registerInt("preprocessing::" + name
+                                                     + "::added")),
+      d_numProcessed(preprocContext->getUserContext(), 0)
 {
   d_preprocContext = preprocContext;
 }
@@ -21,6 +21,8 @@
  *
  * - Dumping assertions before and after the pass
  * - Initializing the timer
+ * - Counting the assertions processed, skipped, rewritten and added by the
+ *   pass
  * - Tracing and chatting
  *
  * Optionally, preprocessing passes can overwrite the initInteral() method to
@@ -34,6 +36,7 @@
 
 #include <string>
 
+#include "context/cdo.h"
 #include "util/statistics_stats.h"
 
 namespace cvc5 {
@@ -57,6 +60,16 @@ class PreprocessingPass {
                     const std::string& name);
   virtual ~PreprocessingPass();
 
+  /*
+   * Whether this pass may be applied in incremental mode. In incremental
+   * mode, each check-sat only preprocesses the assertions added since the
+   * previous one, hence a pass is incremental-safe if its result on these
+   * assertions remains correct together with the assertions preprocessed
+   * earlier and those added later. Passes that are not incremental-safe are
+   * disabled by the option defaults in incremental mode.
+   */
+  virtual bool isIncrementalSafe() const { return true; }
+
  protected:
   /*
    * Method for dumping assertions within a pass. Also called before and after
@@ -78,6 +91,27 @@ class PreprocessingPass {
   std::string d_name;
   /* Timer for registering the preprocessing time of this pass */
   TimerStat d_timer;
+  /*
+   * Number of assertions this pass was applied to. In incremental mode, only
+   * the assertions added since the last check-sat are preprocessed, hence
+   * this counts each assertion once per pass.
+   */
+  IntStat d_numAssertions;
+  /*
+   * Number of assertions this pass was not applied to again, summed over all
+   * applications, since they were already preprocessed for an earlier
+   * check-sat in the current user context.
+   */
+  IntStat d_numSkipped;
+  /* Number of assertions that this pass replaced by a different assertion */
+  IntStat d_numRewritten;
+  /* Number of assertions that this pass added */
+  IntStat d_numAdded;
+  /*
+   * The number of assertions that resulted from this pass in the current user
+   * context, which are the assertions skipped by the next application.
+   */
+  context::CDO<uint64_t> d_numProcessed;
 };
 
 }  // namespace preprocessing
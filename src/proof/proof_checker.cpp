@@ -15,6 +15,8 @@
 
 #include "proof/proof_checker.h"
 
+#include <unordered_map>
+
 #include "expr/skolem_manager.h"
 #include "options/proof_options.h"
 #include "proof/proof_node.h"
@@ -81,7 +83,11 @@ ProofCheckerStatistics::ProofCheckerStatistics()
     : d_ruleChecks(smtStatisticsRegistry().registerHistogram<PfRule>(
           "ProofCheckerStatistics::ruleChecks")),
       d_totalRuleChecks(smtStatisticsRegistry().registerInt(
-          "ProofCheckerStatistics::totalRuleChecks"))
+          "ProofCheckerStatistics::totalRuleChecks")),
+      d_proofNodesChecked(smtStatisticsRegistry().registerInt(
+          "ProofCheckerStatistics::proofNodesChecked")),
+      d_checkProofTime(smtStatisticsRegistry().registerTimer(
+          "ProofCheckerStatistics::checkProofTime"))
 {
 }
 
@@ -178,6 +184,64 @@ Node ProofChecker::checkDebug(PfRule id,
   return res;
 }
 
+bool ProofChecker::checkProof(ProofNode* pn, std::ostream& out)
+{
+  TimerStat::CodeTimer codeTimer(d_stats.d_checkProofTime);
+  // the proof nodes that have been visited, mapped to whether all their
+  // children have been checked
+  std::unordered_map<ProofNode*, bool> visited;
+  std::vector<ProofNode*> visit{pn};
+  ProofNode* cur;
+  while (!visit.empty())
+  {
+    cur = visit.back();
+    auto it = visited.find(cur);
+    if (it == visited.end())
+    {
+      visited[cur] = false;
+      const std::vector<std::shared_ptr<ProofNode>>& cs = cur->getChildren();
+      // push in reverse order so that children are checked from left to right
+      for (auto itc = cs.rbegin(); itc != cs.rend(); ++itc)
+      {
+        if (visited.find(itc->get()) == visited.end())
+        {
+          visit.push_back(itc->get());
+        }
+      }
+      continue;
+    }
+    visit.pop_back();
+    if (it->second)
+    {
+      continue;
+    }
+    it->second = true;
+    ++d_stats.d_proofNodesChecked;
+    PfRule id = cur->getRule();
+    if (id == PfRule::ASSUME)
+    {
+      continue;
+    }
+    std::vector<Node> cchildren;
+    for (const std::shared_ptr<ProofNode>& pc : cur->getChildren())
+    {
+      cchildren.push_back(pc->getResult());
+    }
+    d_stats.d_ruleChecks << id;
+    ++d_stats.d_totalRuleChecks;
+    std::stringstream serr;
+    Node res = checkInternal(
+        id, cchildren, cur->getArguments(), cur->getResult(), serr, true, true);
+    if (res.isNull())
+    {
+      out << "ProofChecker::checkProof: failed to check " << id
+          << " proving " << cur->getResult() << ", " << serr.str();
+      return false;
+    }
+  }
+  return true;
+}
+
 Node ProofChecker::checkInternal(PfRule id,
                                  const std::vector<Node>& cchildren,
                                  const std::vector<Node>& args,
@@ -95,6 +95,10 @@ class ProofCheckerStatistics
   HistogramStat<PfRule> d_ruleChecks;
   /** Total number of rule checks */
   IntStat d_totalRuleChecks;
+  /** Number of distinct proof nodes checked by checkProof */
+  IntStat d_proofNodesChecked;
+  /** Time spent in checkProof */
+  TimerStat d_checkProofTime;
 };
 
 /** A class for checking proofs */
@@ -149,6 +153,19 @@ class ProofChecker
                   const std::vector<Node>& args,
                   Node expected = Node::null(),
                   const char* traceTag = "");
+  /**
+   * Recheck every step of the proof pn against the conclusion it is
+   * annotated with. This traverses the DAG of pn iteratively in post-order,
+   * so that each proof node is checked exactly once, after its children, and
+   * the result does not depend on how often subproofs are shared. Trusted
+   * rules are accepted.
+   *
+   * @param pn The proof to check
+   * @param out The stream to write a description of the first step that
+   * fails to check to, if any
+   * @return true if all steps of pn check
+   */
+  bool checkProof(ProofNode* pn, std::ostream& out);
   /** Indicate that psc is the checker for proof rule id */
   void registerChecker(PfRule id, ProofRuleChecker* psc);
   /**
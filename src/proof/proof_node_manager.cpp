@@ -15,6 +15,7 @@
 
 #include "proof/proof_node_manager.h"
 
+#include <algorithm>
 #include <sstream>
 
 #include "options/proof_options.h"
@@ -22,17 +23,51 @@
 #include "proof/proof_checker.h"
 #include "proof/proof_node.h"
 #include "proof/proof_node_algorithm.h"
+#include "smt/smt_statistics_registry.h"
 #include "theory/rewriter.h"
+#include "util/hash.h"
 
 using namespace cvc5::kind;
 
 namespace cvc5 {
 
-ProofNodeManager::ProofNodeManager(ProofChecker* pc) : d_checker(pc)
+ProofNodeManager::Statistics::Statistics()
+    : d_nodes(smtStatisticsRegistry().registerInt("ProofNodeManager::nodes")),
+      d_sharedNodes(
+          smtStatisticsRegistry().registerInt("ProofNodeManager::sharedNodes")),
+      d_nodeBytes(
+          smtStatisticsRegistry().registerInt("ProofNodeManager::nodeBytes")),
+      d_mkNodeTime(
+          smtStatisticsRegistry().registerTimer("ProofNodeManager::mkNodeTime"))
+{
+}
+
+ProofNodeManager::ProofNodeManager(ProofChecker* pc)
+    : d_checker(pc),
+      d_hashCons(options::proofHashCons()),
+      d_poolSize(0),
+      d_poolSweepSize(1024)
 {
   d_true = NodeManager::currentNM()->mkConst(true);
 }
 
+size_t ProofNodeManager::hashPoolKey(
+    PfRule id,
+    const std::vector<std::shared_ptr<ProofNode>>& children,
+    const std::vector<Node>& args)
+{
+  uint64_t hash = fnv1a::fnv1a_64(static_cast<uint64_t>(id));
+  for (const std::shared_ptr<ProofNode>& c : children)
+  {
+    hash = fnv1a::fnv1a_64(std::hash<ProofNode*>()(c.get()), hash);
+  }
+  for (const Node& a : args)
+  {
+    hash = fnv1a::fnv1a_64(std::hash<Node>()(a), hash);
+  }
+  return static_cast<size_t>(hash);
+}
+
 std::shared_ptr<ProofNode> ProofNodeManager::mkNode(
     PfRule id,
     const std::vector<std::shared_ptr<ProofNode>>& children,
@@ -41,6 +76,12 @@ std::shared_ptr<ProofNode> ProofNodeManager::mkNode(
 {
   Trace("pnm") << "ProofNodeManager::mkNode " << id << " {" << expected.getId()
                << "} " << expected << "\n";
+  // ASSUME proof nodes are placeholders that are updated to proofs which
+  // depend on the context they are used in, hence we never share them
+  if (d_hashCons && id != PfRule::ASSUME)
+  {
+    return mkSharedNode(id, children, args, expected);
+  }
   Node res = checkInternal(id, children, args, expected);
   if (res.isNull())
   {
@@ -54,6 +95,103 @@ std::shared_ptr<ProofNode> ProofNodeManager::mkNode(
   return pn;
 }
 
+std::shared_ptr<ProofNode> ProofNodeManager::mkSharedNode(
+    PfRule id,
+    const std::vector<std::shared_ptr<ProofNode>>& children,
+    const std::vector<Node>& args,
+    Node expected)
+{
+  TimerStat::CodeTimer codeTimer(d_stats.d_mkNodeTime, true);
+  size_t hash = hashPoolKey(id, children, args);
+  std::vector<std::weak_ptr<ProofNode>>& entries = d_pool[hash];
+  for (std::vector<std::weak_ptr<ProofNode>>::iterator it = entries.begin();
+       it != entries.end();)
+  {
+    std::shared_ptr<ProofNode> pn = it->lock();
+    if (pn == nullptr)
+    {
+      // the proof node was freed
+      it = entries.erase(it);
+      d_poolSize--;
+      continue;
+    }
+    // Children are compared by pointer. Since they are themselves shared
+    // proof nodes (unless they are assumptions), this amounts to comparing
+    // them structurally.
+    if (pn->d_rule == id && pn->d_children == children && pn->d_args == args
+        && (expected.isNull() || pn->d_proven == expected))
+    {
+      ++d_stats.d_sharedNodes;
+      return pn;
+    }
+    ++it;
+  }
+  Node res = checkInternal(id, children, args, expected);
+  if (res.isNull())
+  {
+    // if it was invalid, then we return the null node
+    return nullptr;
+  }
+  std::shared_ptr<ProofNode> pn =
+      std::make_shared<ProofNode>(id, children, args);
+  pn->d_proven = res;
+  // checking may have modified d_pool, hence we look up the entries again
+  d_pool[hash].push_back(pn);
+  d_poolSize++;
+  ++d_stats.d_nodes;
+  d_stats.d_nodeBytes += sizeof(ProofNode)
+                         + children.size() * sizeof(std::shared_ptr<ProofNode>)
+                         + args.size() * sizeof(Node);
+  if (d_poolSize >= d_poolSweepSize)
+  {
+    sweepPool();
+  }
+  return pn;
+}
+
+void ProofNodeManager::sweepPool()
+{
+  for (auto it = d_pool.begin(); it != d_pool.end();)
+  {
+    std::vector<std::weak_ptr<ProofNode>>& entries = it->second;
+    for (size_t i = 0; i < entries.size();)
+    {
+      if (entries[i].expired())
+      {
+        entries[i] = entries.back();
+        entries.pop_back();
+        d_poolSize--;
+        continue;
+      }
+      i++;
+    }
+    it = entries.empty() ? d_pool.erase(it) : std::next(it);
+  }
+  // sweep again once the number of entries has doubled
+  d_poolSweepSize = std::max<size_t>(1024, 2 * d_poolSize);
+}
+
+void ProofNodeManager::removeFromPool(ProofNode* pn)
+{
+  std::unordered_map<size_t, std::vector<std::weak_ptr<ProofNode>>>::iterator
+      it = d_pool.find(
+          hashPoolKey(pn->getRule(), pn->getChildren(), pn->getArguments()));
+  if (it == d_pool.end())
+  {
+    return;
+  }
+  std::vector<std::weak_ptr<ProofNode>>& entries = it->second;
+  for (size_t i = 0, nentries = entries.size(); i < nentries; i++)
+  {
+    if (entries[i].lock().get() == pn)
+    {
+      entries.erase(entries.begin() + i);
+      d_poolSize--;
+      return;
+    }
+  }
+}
+
 std::shared_ptr<ProofNode> ProofNodeManager::mkAssume(Node fact)
 {
   Assert(!fact.isNull());
@@ -399,6 +537,13 @@ bool ProofNodeManager::updateNodeInternal(
     Assert(res == pn->d_proven);
   }
 
+  if (d_hashCons)
+  {
+    // The key of pn changes, hence it is no longer found for its old rule
+    // application. Since pn may be shared, the update is visible to all of
+    // its holders, which is fine since it still proves the same fact.
+    removeFromPool(pn);
+  }
   // we update its value
   pn->setValue(id, children, args);
   return true;
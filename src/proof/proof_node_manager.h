@@ -18,10 +18,13 @@
 #ifndef CVC5__PROOF__PROOF_NODE_MANAGER_H
 #define CVC5__PROOF__PROOF_NODE_MANAGER_H
 
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "expr/node.h"
 #include "proof/proof_rule.h"
+#include "util/statistics_stats.h"
 
 namespace cvc5 {
 
@@ -46,10 +49,16 @@ class ProofNode;
  * unchanged and updates (if possible) the remaining content of a given proof
  * node.
  *
- * Notice that ProofNode objects are mutable, and hence this class does not
- * cache the results of mkNode. A version of this class that caches
- * immutable version of ProofNode objects could be built as an extension
- * or layer on top of this class.
+ * Notice that ProofNode objects are mutable, and hence by default this class
+ * does not cache the results of mkNode. If proof hash-consing is enabled
+ * (--proof-hash-cons), then mkNode returns the live proof node constructed for
+ * a structurally identical application of a rule, if any. Children are
+ * compared by pointer, which amounts to comparing them structurally since
+ * they are shared as well. ASSUME proof nodes are never shared. Since
+ * updateNode modifies a proof node in place, an update of a shared proof node
+ * is visible to all of its holders; this is sound since the updated proof node
+ * proves the same fact. This class only holds weak references to the proof
+ * nodes it shares, which are freed as usual once no one else refers to them.
  */
 class ProofNodeManager
 {
@@ -169,10 +178,51 @@ class ProofNodeManager
   std::shared_ptr<ProofNode> clone(std::shared_ptr<ProofNode> pn);
 
  private:
+  /** Statistics of this class, which are only updated when hash-consing */
+  struct Statistics
+  {
+    Statistics();
+    /** Number of proof nodes constructed by mkNode */
+    IntStat d_nodes;
+    /** Number of calls to mkNode that returned an existing proof node */
+    IntStat d_sharedNodes;
+    /** Approximate memory of the proof nodes constructed by mkNode, in bytes */
+    IntStat d_nodeBytes;
+    /** Time spent in mkNode */
+    TimerStat d_mkNodeTime;
+  };
+  /** Hash of the given rule application, for hash-consing */
+  static size_t hashPoolKey(
+      PfRule id,
+      const std::vector<std::shared_ptr<ProofNode>>& children,
+      const std::vector<Node>& args);
+  /**
+   * Make a proof node for the given rule application, or return the existing
+   * proof node for it if possible.
+   */
+  std::shared_ptr<ProofNode> mkSharedNode(
+      PfRule id,
+      const std::vector<std::shared_ptr<ProofNode>>& children,
+      const std::vector<Node>& args,
+      Node expected);
+  /** Remove the entries of d_pool whose proof node has been freed */
+  void sweepPool();
+  /** Remove proof node pn from d_pool, if it is there */
+  void removeFromPool(ProofNode* pn);
   /** The (optional) proof checker */
   ProofChecker* d_checker;
   /** the true node */
   Node d_true;
+  /** Whether we hash-cons proof nodes */
+  bool d_hashCons;
+  /** Maps hashes of rule applications to the proof nodes that may be shared */
+  std::unordered_map<size_t, std::vector<std::weak_ptr<ProofNode>>> d_pool;
+  /** The number of entries in d_pool */
+  size_t d_poolSize;
+  /** The number of entries in d_pool at which we next call sweepPool */
+  size_t d_poolSweepSize;
+  /** The statistics */
+  Statistics d_stats;
   /** Check internal
    *
    * This returns the result of proof checking a ProofNode with the provided
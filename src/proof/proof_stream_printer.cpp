@@ -0,0 +1,97 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2021 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Implementation of the printer that writes proofs step by step.
+ */
+
+#include "proof/proof_stream_printer.h"
+
+#include <vector>
+
+namespace cvc5 {
+namespace proof {
+
+ProofStreamPrinter::ProofStreamPrinter(bool printConclusion)
+    : d_printConclusion(printConclusion)
+{
+}
+
+void ProofStreamPrinter::print(std::ostream& out, const ProofNode* pn)
+{
+  d_ids.clear();
+  uint64_t nextId = 0;
+  // the stack of proof nodes being traversed, paired with the index of the
+  // next child to visit
+  std::vector<std::pair<const ProofNode*, size_t>> visit;
+  visit.emplace_back(pn, 0);
+  while (!visit.empty())
+  {
+    const ProofNode* cur = visit.back().first;
+    size_t& index = visit.back().second;
+    const std::vector<std::shared_ptr<ProofNode>>& cs = cur->getChildren();
+    // skip the children that were already printed
+    while (index < cs.size() && d_ids.find(cs[index].get()) != d_ids.end())
+    {
+      index++;
+    }
+    if (index < cs.size())
+    {
+      const ProofNode* child = cs[index].get();
+      index++;
+      visit.emplace_back(child, 0);
+      continue;
+    }
+    visit.pop_back();
+    // a proof node may be on the stack more than once if it is shared
+    if (d_ids.find(cur) != d_ids.end())
+    {
+      continue;
+    }
+    uint64_t id = nextId++;
+    d_ids[cur] = id;
+    printStep(out, cur, id);
+  }
+  out.flush();
+  d_ids.clear();
+}
+
+void ProofStreamPrinter::printStep(std::ostream& out,
+                                   const ProofNode* pn,
+                                   uint64_t id)
+{
+  out << "(step @p" << id << " :rule " << pn->getRule();
+  const std::vector<std::shared_ptr<ProofNode>>& cs = pn->getChildren();
+  if (!cs.empty())
+  {
+    out << " :premises (";
+    for (size_t i = 0, size = cs.size(); i < size; i++)
+    {
+      out << (i > 0 ? " @p" : "@p") << d_ids[cs[i].get()];
+    }
+    out << ")";
+  }
+  const std::vector<Node>& args = pn->getArguments();
+  if (!args.empty())
+  {
+    out << " :args (";
+    for (size_t i = 0, size = args.size(); i < size; i++)
+    {
+      out << (i > 0 ? " " : "") << args[i];
+    }
+    out << ")";
+  }
+  if (d_printConclusion)
+  {
+    out << " :conclusion " << pn->getResult();
+  }
+  out << ")\n";
+}
+
+}  // namespace proof
+}  // namespace cvc5
@@ -0,0 +1,67 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2021 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A printer that writes proofs step by step.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__PROOF__PROOF_STREAM_PRINTER_H
+#define CVC5__PROOF__PROOF_STREAM_PRINTER_H
+
+#include <iostream>
+#include <unordered_map>
+
+#include "proof/proof_node.h"
+
+namespace cvc5 {
+namespace proof {
+
+/**
+ * Prints a proof as a sequence of steps, one per line, of the form
+ *   (step @p<i> :rule <rule> :premises (@p<j1> ... @p<jn>) :args (<args>))
+ * where @p<i> is the identifier of the step and @p<j1> ... @p<jn> are the
+ * identifiers of the steps for its children. If conclusions are printed, each
+ * step additionally has a `:conclusion` attribute. The last step is the proof
+ * of the root.
+ *
+ * Steps are written in post-order while the proof DAG is traversed, i.e. no
+ * intermediate representation of the proof is constructed, and every proof
+ * node is written exactly once regardless of how often it is shared. Besides
+ * the traversal stack, the memory used is a table mapping each written proof
+ * node to its identifier.
+ */
+class ProofStreamPrinter
+{
+ public:
+  /**
+   * @param printConclusion Whether to print the conclusion of each step
+   */
+  ProofStreamPrinter(bool printConclusion);
+
+  /**
+   * Print the proof pn to out.
+   * @param out the output stream
+   * @param pn the root node of the proof to print
+   */
+  void print(std::ostream& out, const ProofNode* pn);
+
+ private:
+  /** Print the step for pn, whose children were already printed */
+  void printStep(std::ostream& out, const ProofNode* pn, uint64_t id);
+  /** Whether to print the conclusion of each step */
+  bool d_printConclusion;
+  /** Maps each printed proof node to its identifier */
+  std::unordered_map<const ProofNode*, uint64_t> d_ids;
+};
+
+}  // namespace proof
+}  // namespace cvc5
+
+#endif /* CVC5__PROOF__PROOF_STREAM_PRINTER_H */
@@ -20,6 +20,8 @@
 #include "proof/theory_proof_step_buffer.h"
 #include "prop/cnf_stream.h"
 #include "prop/minisat/minisat.h"
+#include "smt/smt_statistics_registry.h"
+#include "util/hash.h"
 
 namespace cvc5 {
 namespace prop {
@@ -31,7 +33,16 @@ SatProofManager::SatProofManager(Minisat::Solver* solver,
     : d_solver(solver),
       d_cnfStream(cnfStream),
       d_pnm(pnm),
-      d_resChains(pnm, true, userContext),
+      d_trace(options::satProofTrace()),
+      d_traceChains(userContext),
+      d_traceIndex(userContext),
+      d_traceGen(*this),
+      d_resChains(pnm,
+                  true,
+                  userContext,
+                  d_trace ? &d_traceGen : nullptr,
+                  true,
+                  "SatProofManager::resChains"),
       d_resChainPg(userContext, pnm),
       d_assumptions(userContext),
       d_conflictLit(undefSatVariable)
@@ -40,6 +51,41 @@ SatProofManager::SatProofManager(Minisat::Solver* solver,
   d_false = NodeManager::currentNM()->mkConst(false);
 }
 
+size_t SatProofManager::SatClauseHashFunction::operator()(
+    const SatClause& clause) const
+{
+  uint64_t hash = fnv1a::fnv1a_64(clause.size());
+  for (const SatLiteral& lit : clause)
+  {
+    hash = fnv1a::fnv1a_64(SatLiteralHashFunction()(lit), hash);
+  }
+  return static_cast<size_t>(hash);
+}
+
+SatProofManager::TraceProofGenerator::TraceProofGenerator(SatProofManager& spm)
+    : d_spm(spm)
+{
+}
+
+std::shared_ptr<ProofNode> SatProofManager::TraceProofGenerator::getProofFor(
+    Node f)
+{
+  return d_spm.getTraceProofFor(f);
+}
+
+std::string SatProofManager::TraceProofGenerator::identify() const
+{
+  return "SatProofManager::TraceProofGenerator";
+}
+
+SatProofManager::TraceStatistics::TraceStatistics()
+    : d_chains(
+          smtStatisticsRegistry().registerInt("SatProofManager::traceChains")),
+      d_convertedChains(smtStatisticsRegistry().registerInt(
+          "SatProofManager::traceConvertedChains"))
+{
+}
+
 void SatProofManager::printClause(const Minisat::Clause& clause)
 {
   for (unsigned i = 0, size = clause.size(); i < size; ++i)
@@ -75,6 +121,29 @@ Node SatProofManager::getClauseNode(const Minisat::Clause& clause)
   return NodeManager::currentNM()->mkNode(kind::OR, clauseNodes);
 }
 
+Node SatProofManager::getClauseNode(const SatClause& clause)
+{
+  if (clause.size() == 1)
+  {
+    return getClauseNode(clause[0]);
+  }
+  std::vector<Node> clauseNodes;
+  for (const SatLiteral& satLit : clause)
+  {
+    clauseNodes.push_back(getClauseNode(satLit));
+  }
+  // order children by node id
+  std::sort(clauseNodes.begin(), clauseNodes.end());
+  return NodeManager::currentNM()->mkNode(kind::OR, clauseNodes);
+}
+
+Node SatProofManager::getPivotNode(SatLiteral lit)
+{
+  Node litNode = d_cnfStream->getNodeCache()[lit];
+  Assert(!lit.isNegated() || litNode.getKind() == kind::NOT);
+  return lit.isNegated() ? litNode[0] : litNode;
+}
+
 void SatProofManager::startResChain(const Minisat::Clause& start)
 {
   if (Trace.isOn("sat-proof"))
@@ -83,12 +152,34 @@ void SatProofManager::startResChain(const Minisat::Clause& start)
     printClause(start);
     Trace("sat-proof") << "\n";
   }
+  if (d_trace)
+  {
+    SatClause clause;
+    for (unsigned i = 0, size = start.size(); i < size; ++i)
+    {
+      clause.push_back(MinisatSatSolver::toSatLiteral(start[i]));
+    }
+    d_traceLinks.push_back({clause, undefSatLiteral, true});
+    return;
+  }
   d_resLinks.emplace_back(getClauseNode(start), Node::null(), true);
 }
 
 void SatProofManager::addResolutionStep(Minisat::Lit lit, bool redundant)
 {
   SatLiteral satLit = MinisatSatSolver::toSatLiteral(lit);
+  if (d_trace)
+  {
+    if (redundant)
+    {
+      d_redundantLits.push_back(satLit);
+    }
+    else
+    {
+      d_traceLinks.push_back({{~satLit}, satLit, !satLit.isNegated()});
+    }
+    return;
+  }
   Node litNode = d_cnfStream->getNodeCache()[satLit];
   bool negated = satLit.isNegated();
   Assert(!negated || litNode.getKind() == kind::NOT);
@@ -116,6 +207,16 @@ void SatProofManager::addResolutionStep(const Minisat::Clause& clause,
                                         Minisat::Lit lit)
 {
   SatLiteral satLit = MinisatSatSolver::toSatLiteral(lit);
+  if (d_trace)
+  {
+    SatClause satClause;
+    for (unsigned i = 0, size = clause.size(); i < size; ++i)
+    {
+      satClause.push_back(MinisatSatSolver::toSatLiteral(clause[i]));
+    }
+    d_traceLinks.push_back({satClause, satLit, satLit.isNegated()});
+    return;
+  }
   Node litNode = d_cnfStream->getNodeCache()[satLit];
   bool negated = satLit.isNegated();
   Assert(!negated || litNode.getKind() == kind::NOT);
@@ -140,6 +241,11 @@ void SatProofManager::endResChain(Minisat::Lit lit)
   SatLiteral satLit = MinisatSatSolver::toSatLiteral(lit);
   Trace("sat-proof") << "SatProofManager::endResChain: chain_res for "
                      << satLit;
+  if (d_trace)
+  {
+    endTraceChain({satLit});
+    return;
+  }
   endResChain(getClauseNode(satLit), {satLit});
 }
 
@@ -155,9 +261,126 @@ void SatProofManager::endResChain(const Minisat::Clause& clause)
   {
     clauseLits.insert(MinisatSatSolver::toSatLiteral(clause[i]));
   }
+  if (d_trace)
+  {
+    endTraceChain(clauseLits);
+    return;
+  }
   endResChain(getClauseNode(clause), clauseLits);
 }
 
+void SatProofManager::endTraceChain(const std::set<SatLiteral>& conclusionLits)
+{
+  Trace("sat-proof") << " (traced)\n";
+  // first process redundant literals, as in endResChain
+  std::set<SatLiteral> visited;
+  unsigned pos = d_traceLinks.size();
+  for (SatLiteral satLit : d_redundantLits)
+  {
+    processRedundantLit(satLit, conclusionLits, visited, pos);
+  }
+  d_redundantLits.clear();
+  TraceChain chain;
+  chain.d_conclusion.assign(conclusionLits.begin(), conclusionLits.end());
+  chain.d_links.swap(d_traceLinks);
+  // whether no-op or trivial cycle, where clauses are compared modulo
+  // ordering, as their nodes are
+  if (chain.d_links.size() == 1)
+  {
+    return;
+  }
+  for (TraceLink& link : chain.d_links)
+  {
+    std::sort(link.d_clause.begin(), link.d_clause.end());
+    if (link.d_clause == chain.d_conclusion)
+    {
+      return;
+    }
+  }
+  // we must overwrite previous chains for the same conclusion, as in
+  // endResChain
+  d_traceIndex[chain.d_conclusion] = d_traceChains.size();
+  d_traceChains.push_back(chain);
+  ++d_traceStats.d_chains;
+}
+
+const SatProofManager::TraceChain* SatProofManager::getTraceChain(
+    const SatClause& clause) const
+{
+  auto it = d_traceIndex.find(clause);
+  if (it == d_traceIndex.end())
+  {
+    return nullptr;
+  }
+  Assert((*it).second < d_traceChains.size());
+  return &d_traceChains[(*it).second];
+}
+
+std::shared_ptr<ProofNode> SatProofManager::getTraceProofFor(Node fact)
+{
+  auto itp = d_traceProofs.find(fact);
+  if (itp != d_traceProofs.end())
+  {
+    return itp->second;
+  }
+  const CnfStream::NodeToLiteralMap& translation =
+      d_cnfStream->getTranslationCache();
+  const TraceChain* chain = nullptr;
+  // the fact is either a clause or a literal
+  if (fact.getKind() == kind::OR)
+  {
+    SatClause clause;
+    for (const Node& n : fact)
+    {
+      auto it = translation.find(n);
+      if (it == translation.end())
+      {
+        clause.clear();
+        break;
+      }
+      clause.push_back((*it).second);
+    }
+    std::sort(clause.begin(), clause.end());
+    if (!clause.empty())
+    {
+      chain = getTraceChain(clause);
+    }
+  }
+  if (chain == nullptr)
+  {
+    auto it = translation.find(fact);
+    if (it != translation.end())
+    {
+      chain = getTraceChain({(*it).second});
+    }
+  }
+  if (chain == nullptr)
+  {
+    d_traceProofs[fact] = nullptr;
+    return nullptr;
+  }
+  Trace("sat-proof") << "SatProofManager::getTraceProofFor: convert chain for "
+                     << fact << "\n";
+  ++d_traceStats.d_convertedChains;
+  // build the resolution step as in endResChain
+  std::vector<std::shared_ptr<ProofNode>> children;
+  std::vector<Node> args{fact};
+  for (size_t i = 0, size = chain->d_links.size(); i < size; ++i)
+  {
+    const TraceLink& link = chain->d_links[i];
+    children.push_back(d_pnm->mkAssume(getClauseNode(link.d_clause)));
+    if (i > 0)
+    {
+      args.push_back(link.d_posFirst ? d_true : d_false);
+      args.push_back(getPivotNode(link.d_pivot));
+    }
+  }
+  std::shared_ptr<ProofNode> pf =
+      d_pnm->mkNode(PfRule::MACRO_RESOLUTION_TRUST, children, args, fact);
+  d_traceProofs[fact] = pf;
+  return pf;
+}
+
 void SatProofManager::endResChain(Node conclusion,
                                   const std::set<SatLiteral>& conclusionLits)
 {
@@ -280,6 +503,12 @@ void SatProofManager::processRedundantLit(
                        << "\n"
                        << pop;
     visited.insert(lit);
+    if (d_trace)
+    {
+      d_traceLinks.insert(d_traceLinks.begin() + pos,
+                          {{~lit}, lit, !lit.isNegated()});
+      return;
+    }
     Node litNode = d_cnfStream->getNodeCache()[lit];
     bool negated = lit.isNegated();
     Assert(!negated || litNode.getKind() == kind::NOT);
@@ -320,6 +549,17 @@ void SatProofManager::processRedundantLit(
   // reason, not only with ~lit, since the learned clause is built under the
   // assumption that the redundant literal is removed via the resolution with
   // the explanation of its negation
+  if (d_trace)
+  {
+    SatClause reasonClause;
+    for (unsigned i = 0, size = reason.size(); i < size; ++i)
+    {
+      reasonClause.push_back(MinisatSatSolver::toSatLiteral(reason[i]));
+    }
+    d_traceLinks.insert(d_traceLinks.begin() + pos,
+                        {reasonClause, lit, !lit.isNegated()});
+    return;
+  }
   Node clauseNode = getClauseNode(reason);
   Node litNode = d_cnfStream->getNodeCache()[lit];
   bool negated = lit.isNegated();
@@ -336,7 +576,8 @@ void SatProofManager::explainLit(SatLiteral lit,
   Trace("sat-proof") << push << "SatProofManager::explainLit: Lit: " << lit;
   Node litNode = getClauseNode(lit);
   Trace("sat-proof") << " [" << litNode << "]\n";
-  if (d_resChainPg.hasProofFor(litNode))
+  if (d_resChainPg.hasProofFor(litNode)
+      || (d_trace && getTraceChain({lit}) != nullptr))
   {
     Trace("sat-proof") << "SatProofManager::explainLit: already justified "
                        << lit << ", ABORT\n"
@@ -452,6 +693,8 @@ void SatProofManager::finalizeProof(Node inConflictNode,
   Trace("sat-proof")
       << "SatProofManager::finalizeProof: conflicting clause node: "
       << inConflictNode << "\n";
+  // proofs converted for a previous refutation may be outdated
+  d_traceProofs.clear();
   // nothing to do
   if (inConflictNode == d_false)
   {
@@ -18,12 +18,18 @@
 #ifndef CVC5__SAT_PROOF_MANAGER_H
 #define CVC5__SAT_PROOF_MANAGER_H
 
+#include <unordered_map>
+
+#include "context/cdhashmap.h"
 #include "context/cdhashset.h"
+#include "context/cdlist.h"
 #include "expr/node.h"
 #include "proof/buffered_proof_generator.h"
 #include "proof/lazy_proof_chain.h"
+#include "proof/proof_generator.h"
 #include "prop/minisat/core/SolverTypes.h"
 #include "prop/sat_solver_types.h"
+#include "util/statistics_stats.h"
 
 namespace Minisat {
 class Solver;
@@ -267,6 +273,14 @@ class CnfStream;
  * finalizeProof
  * getProof
  *
+ * If the option --sat-proof-trace is enabled, the resolution chains of case
+ * (1) and (2) above are not converted to the node level when they are
+ * registered. Instead, they are recorded as a trace of chains over SAT
+ * literals, and the local proof of a clause is only constructed from its
+ * latest chain in the trace when it is required for connecting the refutation
+ * proof, via the default generator of d_resChains. Thus, during search, no
+ * nodes are constructed for learned or deleted clauses, and the chains of
+ * clauses that do not contribute to the final refutation are never converted.
  */
 class SatProofManager
 {
@@ -523,6 +537,73 @@ class SatProofManager
   void finalizeProof(Node inConflictNode,
                      const std::vector<SatLiteral>& inConflict);
 
+  /** A link of a resolution chain in the trace, at the SAT literal level */
+  struct TraceLink
+  {
+    /** The clause of this link */
+    SatClause d_clause;
+    /**
+     * The literal whose node, modulo negation, is the pivot. It is
+     * undefSatLiteral for the first link of a chain.
+     */
+    SatLiteral d_pivot;
+    /** Whether the pivot occurs positively in the previous links */
+    bool d_posFirst;
+  };
+  /** A resolution chain in the trace */
+  struct TraceChain
+  {
+    /** The conclusion of the chain, with its literals sorted */
+    SatClause d_conclusion;
+    /** The links of the chain */
+    std::vector<TraceLink> d_links;
+  };
+  struct SatClauseHashFunction
+  {
+    size_t operator()(const SatClause& clause) const;
+  };
+  /**
+   * The default proof generator of d_resChains when the resolution chains
+   * are traced, which constructs the local proof of a clause from its chain
+   * in the trace.
+   */
+  class TraceProofGenerator : public ProofGenerator
+  {
+   public:
+    TraceProofGenerator(SatProofManager& spm);
+    std::shared_ptr<ProofNode> getProofFor(Node f) override;
+    std::string identify() const override;
+
+   private:
+    SatProofManager& d_spm;
+  };
+  /** Statistics of the resolution chain trace */
+  struct TraceStatistics
+  {
+    TraceStatistics();
+    /** Number of resolution chains recorded in the trace */
+    IntStat d_chains;
+    /**
+     * Number of chains of the trace converted to proof steps, where a chain
+     * converted several times for the same refutation is counted once
+     */
+    IntStat d_convertedChains;
+  };
+  /** Ends the current resolution chain in trace mode */
+  void endTraceChain(const std::set<SatLiteral>& conclusionLits);
+  /**
+   * Get the latest chain of the trace concluding clause, or nullptr if there
+   * is none
+   */
+  const TraceChain* getTraceChain(const SatClause& clause) const;
+  /**
+   * Get the local proof of fact from its chain in the trace, or nullptr if
+   * there is none. The proof is cached in d_traceProofs.
+   */
+  std::shared_ptr<ProofNode> getTraceProofFor(Node fact);
+  /** Gets the pivot node of a link for lit */
+  Node getPivotNode(SatLiteral lit);
+
   /** The SAT solver to which we are managing proofs */
   Minisat::Solver* d_solver;
   /** Pointer to the underlying cnf stream. */
@@ -547,6 +628,29 @@ class SatProofManager
    * This accumulator is reset after each chain resolution. */
   std::vector<SatLiteral> d_redundantLits;
 
+  /** Whether we trace resolution chains rather than registering them */
+  bool d_trace;
+  /**
+   * Resolution steps accumulator for chain resolution in trace mode. This
+   * plays the role of d_resLinks, at the SAT literal level.
+   */
+  std::vector<TraceLink> d_traceLinks;
+  /** The resolution chains of the trace */
+  context::CDList<TraceChain> d_traceChains;
+  /** Maps conclusions to the index of their latest chain in d_traceChains */
+  context::CDHashMap<SatClause, size_t, SatClauseHashFunction> d_traceIndex;
+  /** The default proof generator of d_resChains in trace mode */
+  TraceProofGenerator d_traceGen;
+  /** The statistics of the trace */
+  TraceStatistics d_traceStats;
+  /**
+   * Maps facts to their proofs converted from the trace. Since finalizeProof
+   * requests the proof of false repeatedly, this avoids converting the same
+   * chains again. It is cleared when a new refutation is finalized, as the
+   * chains of the trace may have changed since.
+   */
+  std::unordered_map<Node, std::shared_ptr<ProofNode>> d_traceProofs;
+
   /**
    * Associates clauses to their local proofs. These proofs are local and
    * possibly updated during solving. When the final conclusion is reached, a
@@ -583,6 +687,11 @@ class SatProofManager
    * method always has its children ordered.
    */
   Node getClauseNode(const Minisat::Clause& clause);
+  /**
+   * Gets node equivalent to a clause of the trace, which is a literal if the
+   * clause has one literal, and an ordered OR node otherwise.
+   */
+  Node getClauseNode(const SatClause& clause);
   /** Prints clause, as a sequence of literals, in the "sat-proof" trace. */
   void printClause(const Minisat::Clause& clause);
 }; /* class SatProofManager */
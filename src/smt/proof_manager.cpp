@@ -15,6 +15,8 @@
 
 #include "smt/proof_manager.h"
 
+#include <sstream>
+
 #include "options/base_options.h"
 #include "options/proof_options.h"
 #include "options/smt_options.h"
@@ -22,6 +24,7 @@
 #include "proof/proof_checker.h"
 #include "proof/proof_node_algorithm.h"
 #include "proof/proof_node_manager.h"
+#include "proof/proof_stream_printer.h"
 #include "smt/assertions.h"
 #include "smt/preprocess_proof_generator.h"
 #include "smt/proof_post_processor.h"
@@ -143,8 +146,10 @@ void PfManager::printProof(std::ostream& out,
   std::shared_ptr<ProofNode> fp = getFinalProof(pfn, as);
   // if we are in incremental mode, we don't want to invalidate the proof
   // nodes in fp, since these may be reused in further check-sat calls
+  // the step printer does not modify the proof, hence we do not clone it
   if (options::incrementalSolving()
-      && options::proofFormatMode() != options::ProofFormatMode::NONE)
+      && options::proofFormatMode() != options::ProofFormatMode::NONE
+      && options::proofFormatMode() != options::ProofFormatMode::STEPS)
   {
     fp = d_pnm->clone(fp);
   }
@@ -156,6 +161,13 @@ void PfManager::printProof(std::ostream& out,
     proof::DotPrinter dotPrinter;
     dotPrinter.print(out, fp.get());
   }
+  else if (options::proofFormatMode() == options::ProofFormatMode::STEPS)
+  {
+    proof::ProofStreamPrinter streamPrinter(options::proofPrintConclusion());
+    out << "(proof\n";
+    streamPrinter.print(out, fp.get());
+    out << ")\n";
+  }
   else
   {
     out << "(proof\n";
@@ -169,6 +181,12 @@ void PfManager::checkProof(std::shared_ptr<ProofNode> pfn, Assertions& as)
   std::shared_ptr<ProofNode> fp = getFinalProof(pfn, as);
   Trace("smt-proof-debug") << "PfManager::checkProof: returned " << *fp.get()
                            << std::endl;
+  if (options::checkProofSteps())
+  {
+    std::stringstream serr;
+    bool success = d_pchecker->checkProof(fp.get(), serr);
+    AlwaysAssert(success) << serr.str();
+  }
 }
 
 ProofChecker* PfManager::getProofChecker() const { return d_pchecker.get(); }
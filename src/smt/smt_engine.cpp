@@ -15,6 +15,8 @@
 
 #include "smt/smt_engine.h"
 
+#include <fstream>
+
 #include "base/check.h"
 #include "base/exception.h"
 #include "base/modal_exception.h"
@@ -22,6 +24,7 @@
 #include "decision/decision_engine.h"
 #include "expr/bound_var_manager.h"
 #include "expr/node.h"
+#include "expr/node_serializer.h"
 #include "options/base_options.h"
 #include "options/expr_options.h"
 #include "options/language.h"
@@ -29,6 +32,7 @@
 #include "options/option_exception.h"
 #include "options/printer_options.h"
 #include "options/proof_options.h"
+#include "options/quantifiers_options.h"
 #include "options/smt_options.h"
 #include "options/theory_options.h"
 #include "printer/printer.h"
@@ -82,6 +86,76 @@ using namespace cvc5::theory;
 
 namespace cvc5 {
 
+namespace {
+
+/**
+ * Appends the changes of the statistics of an SmtEngine to a file (if any)
+ * when destroyed.
+ */
+class StatisticsSnapshotWriter
+{
+ public:
+  StatisticsSnapshotWriter(const SmtEngine& smt, const std::string& file)
+      : d_smt(smt), d_file(file)
+  {
+  }
+  ~StatisticsSnapshotWriter()
+  {
+    if (!d_file.empty())
+    {
+      // this may run while unwinding from an exception, hence it must not
+      // throw
+      try
+      {
+        std::ofstream out(d_file, std::ios::app);
+        d_smt.printStatisticsSnapshot(out);
+      }
+      catch (...)
+      {
+      }
+    }
+  }
+
+ private:
+  /** The SmtEngine whose statistics are written */
+  const SmtEngine& d_smt;
+  /** The file to write to */
+  std::string d_file;
+};
+
+/**
+ * Append the free variables of n that are not in visited to vars, in the
+ * order of their first occurrence.
+ */
+void collectVariables(TNode n,
+                      std::unordered_set<TNode>& visited,
+                      std::vector<Node>& vars)
+{
+  std::vector<TNode> visit;
+  visit.push_back(n);
+  do
+  {
+    TNode cur = visit.back();
+    visit.pop_back();
+    if (!visited.insert(cur).second)
+    {
+      continue;
+    }
+    if (cur.getKind() == kind::VARIABLE)
+    {
+      vars.push_back(cur);
+    }
+    // push in reverse, so that children are visited from left to right
+    visit.insert(visit.end(), cur.rbegin(), cur.rend());
+    if (cur.hasOperator())
+    {
+      visit.push_back(cur.getOperator());
+    }
+  } while (!visit.empty());
+}
+
+}  // namespace
+
 SmtEngine::SmtEngine(NodeManager* nm, Options* optr)
     : d_env(new Env(nm, optr)),
       d_state(new SmtEngineState(getContext(), getUserContext(), *this)),
@@ -885,6 +959,10 @@ Result SmtEngine::checkSatInternal(const std::vector<Node>& assumptions,
                                    bool inUnsatCore,
                                    bool isEntailmentCheck)
 {
+  // Append the changes of the statistics to the snapshot file (if any) on
+  // every exit path, including interrupts and exceptions.
+  StatisticsSnapshotWriter snapshotWriter(
+      *this, d_env->getOptions().base.statisticsSnapshotFile);
   try
   {
     SmtScope smts(this);
@@ -933,7 +1011,6 @@ Result SmtEngine::checkSatInternal(const std::vector<Node>& assumptions,
         checkUnsatCore();
       }
     }
-
     return r;
   }
   catch (UnsafeInterruptException& e)
@@ -1732,6 +1809,117 @@ std::vector<Node> SmtEngine::getAssertions()
   return res;
 }
 
+void SmtEngine::dumpPreprocessedAssertions(std::ostream& out)
+{
+  SmtScope smts(this);
+  finishInit();
+  d_state->doPendingPops();
+  Trace("smt") << "SMT dumpPreprocessedAssertions()" << endl;
+  // these preprocessing passes change the meaning of the assertions, which is
+  // accounted for when answering check-sat, but not by a later reload
+  const Options& opts = d_env->getOptions();
+  if (opts.quantifiers.globalNegate || opts.smt.solveRealAsInt
+      || opts.smt.solveIntAsBV > 0)
+  {
+    throw ModalException(
+        "Cannot dump preprocessed assertions when global-negate, "
+        "solve-real-as-int or solve-int-as-bv is enabled.");
+  }
+  // ensure we've processed assertions, including the global definitions that
+  // are otherwise only added at check-sat
+  d_asserts->initializeCheckSat(std::vector<Node>(), false, false);
+  d_smtSolver->processAssertions(*d_asserts);
+
+  theory::SubstitutionMap& sm = d_env->getTopLevelSubstitutions().get();
+  std::vector<Node> substs;
+  for (SubstitutionMap::iterator pos = sm.begin(); pos != sm.end(); ++pos)
+  {
+    substs.push_back((*pos).first);
+    substs.push_back(sm.apply((*pos).first));
+  }
+  const context::CDList<Node>& al = d_smtSolver->getPreprocessedAssertions();
+  std::vector<Node> assertions(al.begin(), al.end());
+
+  std::unordered_set<TNode> visited;
+  std::vector<Node> decls;
+  for (const Node& n : substs)
+  {
+    collectVariables(n, visited, decls);
+  }
+  for (const Node& a : assertions)
+  {
+    collectVariables(a, visited, decls);
+  }
+  expr::NodeSerializer::write(out, {decls, substs, assertions});
+}
+
+std::vector<Node> SmtEngine::loadPreprocessedAssertions(std::istream& in)
+{
+  SmtScope smts(this);
+  finishInit();
+  d_state->doPendingPops();
+  Trace("smt") << "SMT loadPreprocessedAssertions()" << endl;
+  if (d_env->getOptions().smt.produceProofs
+      || d_env->getOptions().smt.unsatCores)
+  {
+    throw ModalException(
+        "Cannot load preprocessed assertions when proofs or unsat cores are "
+        "enabled.");
+  }
+  std::vector<std::vector<Node>> lists = expr::NodeSerializer::read(in);
+  if (lists.size() != 3)
+  {
+    throw Exception("Cannot load preprocessed assertions: wrong format");
+  }
+  const std::vector<Node>& decls = lists[0];
+  const std::vector<Node>& substs = lists[1];
+  const std::vector<Node>& assertions = lists[2];
+  for (const Node& d : decls)
+  {
+    if (d.getKind() != kind::VARIABLE)
+    {
+      throw Exception(
+          "Cannot load preprocessed assertions: declaration is not a "
+          "variable");
+    }
+  }
+  if (substs.size() % 2 != 0)
+  {
+    throw Exception(
+        "Cannot load preprocessed assertions: odd number of substitution "
+        "terms");
+  }
+  for (size_t i = 0, nsubsts = substs.size(); i < nsubsts; i += 2)
+  {
+    const Node& x = substs[i];
+    if (!x.isVar() || x.getKind() == kind::BOUND_VARIABLE
+        || !substs[i + 1].getType().isSubtypeOf(x.getType()))
+    {
+      throw Exception(
+          "Cannot load preprocessed assertions: ill-typed substitution");
+    }
+  }
+  for (const Node& a : assertions)
+  {
+    if (!a.getType().isBoolean())
+    {
+      throw Exception(
+          "Cannot load preprocessed assertions: assertion is not Boolean");
+    }
+  }
+
+  // push the pending assertions first, so that the substitutions below are
+  // not applied to them
+  d_smtSolver->processAssertions(*d_asserts);
+  theory::TrustSubstitutionMap& tls = d_env->getTopLevelSubstitutions();
+  for (size_t i = 0, nsubsts = substs.size(); i < nsubsts; i += 2)
+  {
+    tls.addSubstitution(substs[i], substs[i + 1]);
+  }
+  d_smtSolver->assertPreprocessedAssertions(assertions);
+  return decls;
+}
+
 void SmtEngine::push()
 {
   SmtScope smts(this);
@@ -1858,6 +2046,13 @@ void SmtEngine::printStatisticsDiff(std::ostream& out) const
   d_env->getStatisticsRegistry().storeSnapshot();
 }
 
+void SmtEngine::printStatisticsSnapshot(std::ostream& out) const
+{
+  SmtScope smts(this);
+  d_env->getStatisticsRegistry().printJsonSnapshot(out,
+                                                   d_state->getNumQueries());
+}
+
 void SmtEngine::setUserAttribute(const std::string& attr,
                                  Node expr,
                                  const std::vector<Node>& expr_values,
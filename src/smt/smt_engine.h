@@ -18,6 +18,7 @@
 #ifndef CVC5__SMT_ENGINE_H
 #define CVC5__SMT_ENGINE_H
 
+#include <iosfwd>
 #include <map>
 #include <memory>
 #include <string>
@@ -700,6 +701,29 @@ class CVC5_EXPORT SmtEngine
    */
   std::vector<Node> getAssertions();
 
+  /**
+   * Preprocess the current assertions and write them to out in the binary
+   * format of expr::NodeSerializer, as three lists: the free variables they
+   * contain or that were eliminated by preprocessing, the substitutions of
+   * the eliminated variables as a flat list of variable/term pairs, and the
+   * preprocessed assertions.
+   *
+   * @throw ModalException if a preprocessing option is enabled that does not
+   * preserve satisfiability, e.g. global negation
+   */
+  void dumpPreprocessedAssertions(std::ostream& out);
+
+  /**
+   * Read assertions written by dumpPreprocessedAssertions from in and assert
+   * them without preprocessing them again, and record the substitutions for
+   * model construction. The resulting assertions are equisatisfiable to the
+   * dumped ones. Returns the free variables, which are fresh variables of the
+   * same name and type as the original ones.
+   *
+   * @throw ModalException if proofs or unsat cores are enabled
+   */
+  std::vector<Node> loadPreprocessedAssertions(std::istream& in);
+
   /**
    * Push a user-level context.
    * throw@ ModalException, LogicException, UnsafeInterruptException
@@ -825,6 +849,15 @@ class CVC5_EXPORT SmtEngine
    */
   void printStatisticsDiff(std::ostream&) const;
 
+  /**
+   * Print the changes to the statistics from the statistics registry in the
+   * env object owned by this SmtEngine since this method was called the last
+   * time, as a single line of JSON that also contains timestamps and the
+   * number of satisfiability queries made so far. This is independent of
+   * printStatisticsDiff().
+   */
+  void printStatisticsSnapshot(std::ostream& out) const;
+
   /**
    * Set user attribute.
    * This function is called when an attribute is set by a user.
@@ -33,6 +33,7 @@ SmtEngineState::SmtEngineState(context::Context* c,
       d_pendingPops(0),
       d_fullyInited(false),
       d_queryMade(false),
+      d_numQueries(0),
       d_needPostsolve(false),
       d_status(),
       d_expectedStatus(),
@@ -75,6 +76,7 @@ void SmtEngineState::notifyCheckSat(bool hasAssumptions)
 
   // Note that a query has been made and we are in assert mode
   d_queryMade = true;
+  d_numQueries++;
   d_smtMode = SmtMode::ASSERT;
 
   // push if there are assumptions
@@ -251,6 +253,7 @@ bool SmtEngineState::isFullyReady() const
   return d_fullyInited && d_pendingPops == 0;
 }
 bool SmtEngineState::isQueryMade() const { return d_queryMade; }
+uint64_t SmtEngineState::getNumQueries() const { return d_numQueries; }
 size_t SmtEngineState::getNumUserLevels() const { return d_userLevels.size(); }
 
 SmtMode SmtEngineState::getMode() const { return d_smtMode; }
@@ -173,6 +173,8 @@ class SmtEngineState
    * issued to the SmtEngine.
    */
   bool isQueryMade() const;
+  /** Return the number of notifyCheckSat calls made so far. */
+  uint64_t getNumQueries() const;
   /** Return the user context level.  */
   size_t getNumUserLevels() const;
   /** Get the status of the last check-sat */
@@ -232,6 +234,8 @@ class SmtEngineState
    * a ModalException during notifyCheckSat.
    */
   bool d_queryMade;
+  /** The number of notifyCheckSat calls made so far */
+  uint64_t d_numQueries;
 
   /**
    * Internal status flag to indicate whether we have been issued a
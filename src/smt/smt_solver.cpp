@@ -44,7 +44,8 @@ SmtSolver::SmtSolver(SmtEngine& smt,
       d_stats(stats),
       d_pnm(nullptr),
       d_theoryEngine(nullptr),
-      d_propEngine(nullptr)
+      d_propEngine(nullptr),
+      d_ppAssertions(env.getUserContext())
 {
 }
 
@@ -245,12 +246,30 @@ void SmtSolver::processAssertions(Assertions& as)
     // specially.
     preprocessing::IteSkolemMap& ism = ap.getIteSkolemMap();
     d_propEngine->assertInputFormulas(assertions, ism);
+    for (const Node& a : assertions)
+    {
+      d_ppAssertions.push_back(a);
+    }
   }
 
   // clear the current assertions
   as.clearCurrent();
 }
 
+void SmtSolver::assertPreprocessedAssertions(
+    const std::vector<Node>& assertions)
+{
+  Assert(d_state.isFullyReady());
+  // the skolem definitions of the original preprocessing are ordinary
+  // assertions here
+  preprocessing::IteSkolemMap ism;
+  d_propEngine->assertInputFormulas(assertions, ism);
+  for (const Node& a : assertions)
+  {
+    d_ppAssertions.push_back(a);
+  }
+}
+
 void SmtSolver::setProofNodeManager(ProofNodeManager* pnm) { d_pnm = pnm; }
 
 TheoryEngine* SmtSolver::getTheoryEngine() { return d_theoryEngine.get(); }
@@ -265,5 +284,10 @@ theory::QuantifiersEngine* SmtSolver::getQuantifiersEngine()
 
 Preprocessor* SmtSolver::getPreprocessor() { return &d_pp; }
 
+const context::CDList<Node>& SmtSolver::getPreprocessedAssertions() const
+{
+  return d_ppAssertions;
+}
+
 }  // namespace smt
 }  // namespace cvc5
@@ -20,6 +20,7 @@
 
 #include <vector>
 
+#include "context/cdlist.h"
 #include "expr/node.h"
 #include "theory/logic_info.h"
 #include "util/result.h"
@@ -117,6 +118,11 @@ class SmtSolver
    * into the SMT solver, and clears the buffer.
    */
   void processAssertions(Assertions& as);
+  /**
+   * Push assertions that were already preprocessed, e.g. by another instance
+   * of cvc5, into the SMT solver without preprocessing them again.
+   */
+  void assertPreprocessedAssertions(const std::vector<Node>& assertions);
   /**
    * Set proof node manager. Enables proofs in this SmtSolver. Should be
    * called before finishInit.
@@ -131,6 +137,11 @@ class SmtSolver
   theory::QuantifiersEngine* getQuantifiersEngine();
   /** Get a pointer to the preprocessor */
   Preprocessor* getPreprocessor();
+  /**
+   * Get the assertions that were pushed into the SMT solver in the current
+   * user context, after preprocessing.
+   */
+  const context::CDList<Node>& getPreprocessedAssertions() const;
   //------------------------------------------ end access methods
 
  private:
@@ -153,6 +164,8 @@ class SmtSolver
   std::unique_ptr<TheoryEngine> d_theoryEngine;
   /** The propositional engine */
   std::unique_ptr<prop::PropEngine> d_propEngine;
+  /** The preprocessed assertions pushed into the propositional engine */
+  context::CDList<Node> d_ppAssertions;
 };
 
 }  // namespace smt
@@ -43,8 +43,12 @@ namespace cad {
 
 CDCAC::CDCAC(context::Context* ctx,
              ProofNodeManager* pnm,
-             const std::vector<poly::Variable>& ordering)
-    : d_variableOrdering(ordering)
+             const std::vector<poly::Variable>& ordering,
+             StatisticsRegistry* registry)
+    : d_variableOrdering(ordering),
+      d_localRegistry(registry == nullptr ? new StatisticsRegistry(false)
+                                          : nullptr),
+      d_stats(registry == nullptr ? *d_localRegistry : *registry)
 {
   if (pnm != nullptr)
   {
@@ -52,6 +56,30 @@ CDCAC::CDCAC(context::Context* ctx,
   }
 }
 
+CDCAC::Statistics::Statistics(StatisticsRegistry& registry)
+    : d_discriminantHits(registry.registerInt(
+          "theory::arith::cad::discriminant-cache-hits")),
+      d_discriminantMisses(registry.registerInt(
+          "theory::arith::cad::discriminant-cache-misses")),
+      d_resultantHits(registry.registerInt(
+          "theory::arith::cad::resultant-cache-hits")),
+      d_resultantMisses(registry.registerInt(
+          "theory::arith::cad::resultant-cache-misses")),
+      d_intervalHits(registry.registerInt(
+          "theory::arith::cad::interval-cache-hits")),
+      d_cacheClears(registry.registerInt(
+          "theory::arith::cad::cache-clears")),
+      d_sampledCells(registry.registerInt(
+          "theory::arith::cad::sampled-cells")),
+      d_unsatIntervalsTime(registry.registerTimer(
+          "theory::arith::cad::unsat-intervals-time")),
+      d_characterizationTime(registry.registerTimer(
+          "theory::arith::cad::characterization-time")),
+      d_intervalFromCharTime(registry.registerTimer(
+          "theory::arith::cad::interval-from-characterization-time"))
+{
+}
+
 void CDCAC::reset()
 {
   d_constraints.reset();
@@ -61,8 +89,15 @@ void CDCAC::reset()
 void CDCAC::computeVariableOrdering()
 {
   // Actually compute the variable ordering
-  d_variableOrdering = d_varOrder(d_constraints.getConstraints(),
-                                  VariableOrderingStrategy::BROWN);
+  std::vector<poly::Variable> ordering = d_varOrder(
+      d_constraints.getConstraints(), VariableOrderingStrategy::BROWN);
+  if (ordering != d_variableOrdering)
+  {
+    // cached projections are only valid for the ordering they were computed
+    // with
+    clearCaches();
+  }
+  d_variableOrdering = ordering;
   Trace("cdcac") << "Variable ordering is now " << d_variableOrdering
                  << std::endl;
 
@@ -99,8 +134,81 @@ const std::vector<poly::Variable>& CDCAC::getVariableOrdering() const
   return d_variableOrdering;
 }
 
+void CDCAC::clearCaches()
+{
+  if (d_discriminants.empty() && d_resultants.empty()
+      && d_baseIntervals.empty())
+  {
+    return;
+  }
+  ++d_stats.d_cacheClears;
+  d_discriminants.clear();
+  d_resultants.clear();
+  d_baseIntervals.clear();
+}
+
+template <typename Cache>
+void CDCAC::limitCache(Cache& cache)
+{
+  if (cache.size() >= s_maxCacheSize)
+  {
+    ++d_stats.d_cacheClears;
+    cache.clear();
+  }
+}
+
+poly::Polynomial CDCAC::getDiscriminant(const poly::Polynomial& p)
+{
+  auto it = d_discriminants.find(p);
+  if (it != d_discriminants.end())
+  {
+    ++d_stats.d_discriminantHits;
+    return it->second;
+  }
+  ++d_stats.d_discriminantMisses;
+  poly::Polynomial res = discriminant(p);
+  limitCache(d_discriminants);
+  d_discriminants.emplace(p, res);
+  return res;
+}
+
+poly::Polynomial CDCAC::getResultant(const poly::Polynomial& p,
+                                     const poly::Polynomial& q)
+{
+  std::pair<poly::Polynomial, poly::Polynomial> key(p, q);
+  auto it = d_resultants.find(key);
+  if (it != d_resultants.end())
+  {
+    ++d_stats.d_resultantHits;
+    return it->second;
+  }
+  ++d_stats.d_resultantMisses;
+  poly::Polynomial res = resultant(p, q);
+  limitCache(d_resultants);
+  d_resultants.emplace(key, res);
+  return res;
+}
+
+const std::vector<poly::Interval>& CDCAC::getBaseIntervals(
+    const poly::Polynomial& p, poly::SignCondition sc)
+{
+  std::pair<poly::Polynomial, poly::SignCondition> key(p, sc);
+  auto it = d_baseIntervals.find(key);
+  if (it != d_baseIntervals.end())
+  {
+    ++d_stats.d_intervalHits;
+    return it->second;
+  }
+  // the assignment does not contain any variable of p
+  std::vector<poly::Interval> intervals =
+      poly::infeasible_regions(p, d_assignment, sc);
+  limitCache(d_baseIntervals);
+  return d_baseIntervals.emplace(key, std::move(intervals)).first->second;
+}
+
 std::vector<CACInterval> CDCAC::getUnsatIntervals(std::size_t cur_variable)
 {
+  TimerStat::CodeTimer codeTimer(d_stats.d_unsatIntervalsTime);
   std::vector<CACInterval> res;
   LazardEvaluation le;
   if (options::nlCadLifting() == options::NlCadLiftingMode::LAZARD)
@@ -127,7 +235,11 @@ std::vector<CACInterval> CDCAC::getUnsatIntervals(std::size_t cur_variable)
     Trace("cdcac") << "Infeasible intervals for " << p << " " << sc
                    << " 0 over " << d_assignment << std::endl;
     std::vector<poly::Interval> intervals;
-    if (options::nlCadLifting() == options::NlCadLiftingMode::LAZARD)
+    if (cur_variable == 0)
+    {
+      intervals = getBaseIntervals(p, sc);
+    }
+    else if (options::nlCadLifting() == options::NlCadLiftingMode::LAZARD)
     {
       intervals = le.infeasibleRegions(p, sc);
       if (Trace.isOn("cdcac"))
@@ -186,11 +298,57 @@ bool CDCAC::sampleOutsideWithInitial(const std::vector<CACInterval>& infeasible,
     sample = suggested;
     return true;
   }
+  if (options::nlCadSampleCells() > 1)
+  {
+    return sampleSimplest(infeasible, sample);
+  }
   return sampleOutside(infeasible, sample);
 }
 
 namespace {
 
+/**
+ * Rank a sample by how expensive it is to lift over it: integers are cheapest,
+ * followed by dyadic rationals, rationals and finally real algebraic numbers.
+ */
+std::size_t sampleComplexity(const poly::Value& v)
+{
+  if (is_integer(v)) return 0;
+  if (is_dyadic_rational(v)) return 1;
+  if (is_rational(v)) return 2;
+  return 3;
+}
+
+}  // namespace
+
+bool CDCAC::sampleSimplest(const std::vector<CACInterval>& infeasible,
+                           poly::Value& sample)
+{
+  std::vector<poly::Value> samples;
+  if (!sampleOutside(infeasible, samples, options::nlCadSampleCells()))
+  {
+    return false;
+  }
+  std::size_t best = 0;
+  std::size_t bestComplexity = sampleComplexity(samples[0]);
+  for (std::size_t i = 1, n = samples.size(); i < n && bestComplexity > 0; ++i)
+  {
+    std::size_t c = sampleComplexity(samples[i]);
+    if (c < bestComplexity)
+    {
+      best = i;
+      bestComplexity = c;
+    }
+  }
+  Trace("cdcac") << "Sampled " << samples << ", using " << samples[best]
+                 << std::endl;
+  d_stats.d_sampledCells += samples.size();
+  sample = samples[best];
+  return true;
+}
+
+namespace {
+
 /**
  * This method follows the projection operator as detailed in algorithm 6 of
  * 10.1016/j.jlamp.2020.100633, which mostly follows the projection operator due
@@ -323,6 +481,7 @@ PolyVector CDCAC::requiredCoefficients(const poly::Polynomial& p)
 PolyVector CDCAC::constructCharacterization(std::vector<CACInterval>& intervals)
 {
   Assert(!intervals.empty()) << "A covering can not be empty";
+  TimerStat::CodeTimer codeTimer(d_stats.d_characterizationTime);
   Trace("cdcac") << "Constructing characterization now" << std::endl;
   PolyVector res;
 
@@ -345,10 +504,10 @@ PolyVector CDCAC::constructCharacterization(std::vector<CACInterval>& intervals)
     }
     for (const auto& p : i.d_mainPolys)
     {
-      Trace("cdcac") << "Discriminant of " << p << " -> " << discriminant(p)
-                     << std::endl;
+      poly::Polynomial disc = getDiscriminant(p);
+      Trace("cdcac") << "Discriminant of " << p << " -> " << disc << std::endl;
       // Add all discriminants
-      res.add(discriminant(p));
+      res.add(disc);
 
       for (const auto& q : requiredCoefficients(p))
       {
@@ -361,18 +520,20 @@ PolyVector CDCAC::constructCharacterization(std::vector<CACInterval>& intervals)
         if (p == q) continue;
         // Check whether p(s \times a) = 0 for some a <= l
         if (!hasRootBelow(q, get_lower(i.d_interval))) continue;
+        poly::Polynomial r = getResultant(p, q);
         Trace("cdcac") << "Resultant of " << p << " and " << q << " -> "
-                       << resultant(p, q) << std::endl;
-        res.add(resultant(p, q));
+                       << r << std::endl;
+        res.add(r);
       }
       for (const auto& q : i.d_upperPolys)
       {
         if (p == q) continue;
         // Check whether p(s \times a) = 0 for some a >= u
         if (!hasRootAbove(q, get_upper(i.d_interval))) continue;
+        poly::Polynomial r = getResultant(p, q);
         Trace("cdcac") << "Resultant of " << p << " and " << q << " -> "
-                       << resultant(p, q) << std::endl;
-        res.add(resultant(p, q));
+                       << r << std::endl;
+        res.add(r);
       }
     }
   }
@@ -384,9 +545,10 @@ PolyVector CDCAC::constructCharacterization(std::vector<CACInterval>& intervals)
     {
       for (const auto& q : intervals[i + 1].d_lowerPolys)
       {
+        poly::Polynomial r = getResultant(p, q);
         Trace("cdcac") << "Resultant of " << p << " and " << q << " -> "
-                       << resultant(p, q) << std::endl;
-        res.add(resultant(p, q));
+                       << r << std::endl;
+        res.add(r);
       }
     }
   }
@@ -402,6 +564,7 @@ CACInterval CDCAC::intervalFromCharacterization(
     std::size_t cur_variable,
     const poly::Value& sample)
 {
+  TimerStat::CodeTimer codeTimer(d_stats.d_intervalFromCharTime);
   PolyVector l;
   PolyVector u;
   PolyVector m;
@@ -23,12 +23,15 @@
 
 #include <poly/polyxx.h>
 
+#include <map>
+#include <memory>
 #include <vector>
 
 #include "theory/arith/nl/cad/cdcac_utils.h"
 #include "theory/arith/nl/cad/constraints.h"
 #include "theory/arith/nl/cad/proof_generator.h"
 #include "theory/arith/nl/cad/variable_ordering.h"
+#include "util/statistics_registry.h"
 
 namespace cvc5 {
 namespace theory {
@@ -46,10 +49,15 @@ namespace cad {
 class CDCAC
 {
  public:
-  /** Initialize this method with the given variable ordering. */
+  /**
+   * Initialize this method with the given variable ordering. The statistics
+   * are registered with registry, or with a local registry if registry is
+   * null.
+   */
   CDCAC(context::Context* ctx,
         ProofNodeManager* pnm,
-        const std::vector<poly::Variable>& ordering = {});
+        const std::vector<poly::Variable>& ordering = {},
+        StatisticsRegistry* registry = nullptr);
 
   /** Reset this instance. */
   void reset();
@@ -99,6 +107,14 @@ class CDCAC
                                 poly::Value& sample,
                                 std::size_t cur_variable);
 
+  /**
+   * Sample outside of the set of intervals, in up to
+   * options::nlCadSampleCells() of the uncovered cells, and choose the sample
+   * that is cheapest to lift over. Returns whether a sample was found.
+   */
+  bool sampleSimplest(const std::vector<CACInterval>& infeasible,
+                      poly::Value& sample);
+
   /**
    * Collects the coefficients required for projection from the given
    * polynomial. Implements Algorithm 6, depending on the command line
@@ -185,6 +201,33 @@ class CDCAC
    */
   void pruneRedundantIntervals(std::vector<CACInterval>& intervals);
 
+  /** Get the discriminant of p, using d_discriminants as a cache. */
+  poly::Polynomial getDiscriminant(const poly::Polynomial& p);
+  /** Get the resultant of p and q, using d_resultants as a cache. */
+  poly::Polynomial getResultant(const poly::Polynomial& p,
+                                const poly::Polynomial& q);
+  /**
+   * Get the infeasible regions of the constraint p sc 0, where p is univariate
+   * in the first variable of d_variableOrdering. These regions do not depend
+   * on the current assignment, hence we cache them in d_baseIntervals.
+   */
+  const std::vector<poly::Interval>& getBaseIntervals(
+      const poly::Polynomial& p, poly::SignCondition sc);
+  /**
+   * Clear the caches above. This is required whenever the variable ordering
+   * changes, as both the results and the comparison of polynomials depend on
+   * the variable ordering of libpoly.
+   */
+  void clearCaches();
+  /**
+   * Clear cache if it has reached its maximal size, before adding a new
+   * entry.
+   */
+  template <typename Cache>
+  void limitCache(Cache& cache);
+  /** The maximal number of entries of each of the caches */
+  static constexpr size_t s_maxCacheSize = 10000;
+
   /**
    * The current assignment. When the method terminates with SAT, it contains a
    * model for the input constraints.
@@ -205,6 +248,50 @@ class CDCAC
 
   /** The proof generator */
   std::unique_ptr<CADProofGenerator> d_proof;
+
+  /**
+   * Cache of discriminants. Unlike the constraints and the assignment, the
+   * caches are not cleared by reset(), so that projections are reused across
+   * calls as long as the variable ordering stays the same. As the cached
+   * results only depend on their key, they remain valid on backtracking.
+   */
+  std::map<poly::Polynomial, poly::Polynomial> d_discriminants;
+  /** Cache of resultants */
+  std::map<std::pair<poly::Polynomial, poly::Polynomial>, poly::Polynomial>
+      d_resultants;
+  /** Cache of infeasible regions of constraints in the first variable */
+  std::map<std::pair<poly::Polynomial, poly::SignCondition>,
+           std::vector<poly::Interval>>
+      d_baseIntervals;
+
+  /** The registry for the statistics, if none was given */
+  std::unique_ptr<StatisticsRegistry> d_localRegistry;
+  /** Statistics on cache reuse and time spent in the phases of the method */
+  struct Statistics
+  {
+    /** Number of discriminants taken from the cache */
+    IntStat d_discriminantHits;
+    /** Number of discriminants that were computed */
+    IntStat d_discriminantMisses;
+    /** Number of resultants taken from the cache */
+    IntStat d_resultantHits;
+    /** Number of resultants that were computed */
+    IntStat d_resultantMisses;
+    /** Number of infeasible regions of constraints taken from the cache */
+    IntStat d_intervalHits;
+    /** Number of times the caches were cleared */
+    IntStat d_cacheClears;
+    /** Number of cells sampled in by sampleSimplest */
+    IntStat d_sampledCells;
+    /** Time spent in getUnsatIntervals */
+    TimerStat d_unsatIntervalsTime;
+    /** Time spent in constructCharacterization */
+    TimerStat d_characterizationTime;
+    /** Time spent in intervalFromCharacterization */
+    TimerStat d_intervalFromCharTime;
+    Statistics(StatisticsRegistry& registry);
+  };
+  Statistics d_stats;
 };
 
 }  // namespace cad
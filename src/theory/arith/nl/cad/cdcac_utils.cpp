@@ -199,10 +199,24 @@ std::vector<Node> collectConstraints(const std::vector<CACInterval>& intervals)
 
 bool sampleOutside(const std::vector<CACInterval>& infeasible, Value& sample)
 {
+  std::vector<Value> samples;
+  if (!sampleOutside(infeasible, samples, 1))
+  {
+    return false;
+  }
+  sample = samples.front();
+  return true;
+}
+
+bool sampleOutside(const std::vector<CACInterval>& infeasible,
+                   std::vector<Value>& samples,
+                   std::size_t maxSamples)
+{
+  Assert(maxSamples > 0);
   if (infeasible.empty())
   {
     // No infeasible region, just take anything: zero
-    sample = poly::Integer();
+    samples.emplace_back(poly::Integer());
     return true;
   }
   if (!is_minus_infinity(get_lower(infeasible.front().d_interval)))
@@ -211,9 +225,9 @@ bool sampleOutside(const std::vector<CACInterval>& infeasible, Value& sample)
     Trace("cdcac") << "Sample before " << infeasible.front().d_interval
                    << std::endl;
     const auto* i = infeasible.front().d_interval.get_internal();
-    sample = value_between(
-        Value::minus_infty().get_internal(), true, &i->a, !i->a_open);
-    return true;
+    samples.emplace_back(value_between(
+        Value::minus_infty().get_internal(), true, &i->a, !i->a_open));
+    if (samples.size() >= maxSamples) return true;
   }
   for (std::size_t i = 0, n = infeasible.size(); i < n - 1; ++i)
   {
@@ -230,13 +244,14 @@ bool sampleOutside(const std::vector<CACInterval>& infeasible, Value& sample)
 
       if (l->is_point)
       {
-        sample = value_between(&l->a, true, &r->a, !r->a_open);
+        samples.emplace_back(value_between(&l->a, true, &r->a, !r->a_open));
       }
       else
       {
-        sample = value_between(&l->b, !l->b_open, &r->a, !r->a_open);
+        samples.emplace_back(
+            value_between(&l->b, !l->b_open, &r->a, !r->a_open));
       }
-      return true;
+      if (samples.size() >= maxSamples) return true;
     }
     else
     {
@@ -252,17 +267,16 @@ bool sampleOutside(const std::vector<CACInterval>& infeasible, Value& sample)
     const auto* i = infeasible.back().d_interval.get_internal();
     if (i->is_point)
     {
-      sample =
-          value_between(&i->a, true, Value::plus_infty().get_internal(), true);
+      samples.emplace_back(
+          value_between(&i->a, true, Value::plus_infty().get_internal(), true));
     }
     else
     {
-      sample = value_between(
-          &i->b, !i->b_open, Value::plus_infty().get_internal(), true);
+      samples.emplace_back(value_between(
+          &i->b, !i->b_open, Value::plus_infty().get_internal(), true));
     }
-    return true;
   }
-  return false;
+  return !samples.empty();
 }
 
 namespace {
@@ -93,6 +93,16 @@ std::vector<Node> collectConstraints(const std::vector<CACInterval>& intervals);
 bool sampleOutside(const std::vector<CACInterval>& infeasible,
                    poly::Value& sample);
 
+/**
+ * Sample points outside of the infeasible intervals, one from each of the
+ * first maxSamples cells (the unbounded cells below and above the intervals
+ * and the gaps between them) that are not covered. Appends the samples to
+ * samples, returns whether any such sample exists.
+ */
+bool sampleOutside(const std::vector<CACInterval>& infeasible,
+                   std::vector<poly::Value>& samples,
+                   std::size_t maxSamples);
+
 /**
  * Compute the finest square of the upper polynomials of lhs and the lower
  * polynomials of rhs. Also pushes reduced polynomials to lower level if
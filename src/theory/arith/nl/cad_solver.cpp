@@ -16,6 +16,7 @@
 #include "theory/arith/nl/cad_solver.h"
 
 #include "expr/skolem_manager.h"
+#include "smt/smt_statistics_registry.h"
 #include "theory/arith/inference_manager.h"
 #include "theory/arith/nl/cad/cdcac.h"
 #include "theory/arith/nl/nl_model.h"
@@ -33,7 +34,7 @@ CadSolver::CadSolver(InferenceManager& im,
                      ProofNodeManager* pnm)
     :
 #ifdef CVC5_POLY_IMP
-      d_CAC(ctx, pnm),
+      d_CAC(ctx, pnm, {}, &smtStatisticsRegistry()),
 #endif
       d_foundSatisfiability(false),
       d_im(im),
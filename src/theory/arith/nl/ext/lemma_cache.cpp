@@ -0,0 +1,83 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2021 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Cache for lemmas generated for individual monomials.
+ */
+
+#include "theory/arith/nl/ext/lemma_cache.h"
+
+#include "options/arith_options.h"
+#include "proof/proof.h"
+#include "smt/smt_statistics_registry.h"
+#include "theory/arith/inference_manager.h"
+#include "theory/arith/nl/ext/ext_state.h"
+
+namespace cvc5 {
+namespace theory {
+namespace arith {
+namespace nl {
+
+LemmaCache::LemmaCache(ExtState* data, const std::string& name)
+    : d_data(data),
+      d_current(nullptr),
+      d_hits(smtStatisticsRegistry().registerInt("nl::" + name
+                                                 + "::lemmaCacheHits")),
+      d_misses(smtStatisticsRegistry().registerInt("nl::" + name
+                                                   + "::lemmaCacheMisses"))
+{
+}
+
+bool LemmaCache::isEnabled() const
+{
+  return options::nlExtLemmaCache() && !d_data->isProofEnabled();
+}
+
+bool LemmaCache::replay(const Node& t,
+                        std::vector<Node>& sig,
+                        bool asWaitingLemmas)
+{
+  d_current = nullptr;
+  if (!isEnabled())
+  {
+    return false;
+  }
+  Entry& e = d_entries[t];
+  if (!e.d_signature.empty() && e.d_signature == sig)
+  {
+    ++d_hits;
+    for (const std::pair<Node, InferenceId>& lem : e.d_lemmas)
+    {
+      d_data->d_im.addPendingLemma(
+          lem.first, lem.second, nullptr, asWaitingLemmas);
+    }
+    return true;
+  }
+  ++d_misses;
+  e.d_signature.swap(sig);
+  e.d_lemmas.clear();
+  d_current = &e;
+  return false;
+}
+
+void LemmaCache::addLemma(const Node& lemma,
+                          InferenceId id,
+                          CDProof* proof,
+                          bool asWaitingLemmas)
+{
+  if (d_current != nullptr)
+  {
+    d_current->d_lemmas.emplace_back(lemma, id);
+  }
+  d_data->d_im.addPendingLemma(lemma, id, proof, asWaitingLemmas);
+}
+
+}  // namespace nl
+}  // namespace arith
+}  // namespace theory
+}  // namespace cvc5
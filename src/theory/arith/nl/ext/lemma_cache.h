@@ -0,0 +1,94 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2021 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Cache for lemmas generated for individual monomials.
+ */
+
+#ifndef CVC5__THEORY__ARITH__NL__EXT__LEMMA_CACHE_H
+#define CVC5__THEORY__ARITH__NL__EXT__LEMMA_CACHE_H
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "expr/node.h"
+#include "theory/inference_id.h"
+#include "util/statistics_stats.h"
+
+namespace cvc5 {
+
+class CDProof;
+
+namespace theory {
+namespace arith {
+namespace nl {
+
+struct ExtState;
+
+/**
+ * Caches the lemmas that a check generated for a monomial, together with a
+ * signature of the model values the lemmas were computed from. When the check
+ * runs again for the monomial and the signature did not change, it would
+ * generate the same lemmas, so they are re-sent from the cache instead.
+ *
+ * The cache is only used if options::nlExtLemmaCache() is set and proofs are
+ * disabled, as cached lemmas are re-sent without proofs.
+ */
+class LemmaCache
+{
+ public:
+  /** The statistics of this cache are registered under nl::<name>:: */
+  LemmaCache(ExtState* data, const std::string& name);
+
+  /**
+   * If lemmas were cached for t with signature sig, add them as pending (or
+   * waiting) lemmas again and return true. Otherwise, start a new cache entry
+   * for t with signature sig and return false. All subsequent calls to
+   * addLemma add their lemma to this entry.
+   */
+  bool replay(const Node& t, std::vector<Node>& sig, bool asWaitingLemmas);
+  /**
+   * Add a pending (or waiting) lemma, and add it to the entry started by the
+   * last call to replay, if any.
+   */
+  void addLemma(const Node& lemma,
+                InferenceId id,
+                CDProof* proof,
+                bool asWaitingLemmas);
+
+ private:
+  /** Whether the cache is used */
+  bool isEnabled() const;
+  /** A cache entry */
+  struct Entry
+  {
+    /** The signature the lemmas were computed from */
+    std::vector<Node> d_signature;
+    /** The lemmas and their inference ids */
+    std::vector<std::pair<Node, InferenceId>> d_lemmas;
+  };
+  /** The data of the nonlinear extension */
+  ExtState* d_data;
+  /** The cache entries, by monomial */
+  std::map<Node, Entry> d_entries;
+  /** The entry lemmas are currently added to, if any */
+  Entry* d_current;
+  /** Number of monomials whose lemmas were taken from the cache */
+  IntStat d_hits;
+  /** Number of monomials whose lemmas were computed */
+  IntStat d_misses;
+};
+
+}  // namespace nl
+}  // namespace arith
+}  // namespace theory
+}  // namespace cvc5
+
+#endif
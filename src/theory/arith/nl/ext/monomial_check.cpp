@@ -29,7 +29,8 @@ namespace theory {
 namespace arith {
 namespace nl {
 
-MonomialCheck::MonomialCheck(ExtState* data) : d_data(data)
+MonomialCheck::MonomialCheck(ExtState* data)
+    : d_data(data), d_signLemmaCache(data, "monomialSign")
 {
   d_order_points.push_back(d_data->d_neg_one);
   d_order_points.push_back(d_data->d_zero);
@@ -68,7 +69,7 @@ void MonomialCheck::init(const std::vector<Node>& xts)
 
 void MonomialCheck::checkSign()
 {
-  std::map<Node, int> signs;
+  NodeManager* nm = NodeManager::currentNM();
   Trace("nl-ext") << "Get monomial sign lemmas..." << std::endl;
   for (unsigned j = 0; j < d_data->d_ms.size(); j++)
   {
@@ -84,8 +85,30 @@ void MonomialCheck::checkSign()
       }
       if (d_m_nconst_factor.find(a) == d_m_nconst_factor.end())
       {
-        signs[a] = compareSign(a, a, 0, 1, exp);
-        if (signs[a] == 0)
+        // the lemmas for a only depend on the signs of a and its variables
+        std::vector<Node> sig;
+        bool hasZeroFactor = false;
+        Node mva = d_data->d_model.computeAbstractModelValue(a);
+        sig.emplace_back(nm->mkConst(Rational(mva.getConst<Rational>().sgn())));
+        for (const Node& v : d_data->d_mdb.getVariableList(a))
+        {
+          int sgn = d_data->d_model.computeAbstractModelValue(v)
+                        .getConst<Rational>()
+                        .sgn();
+          hasZeroFactor = hasZeroFactor || sgn == 0;
+          sig.emplace_back(nm->mkConst(Rational(sgn)));
+        }
+        int sign;
+        if (d_signLemmaCache.replay(a, sig, false))
+        {
+          // compareSign returns zero iff a factor is zero in the model
+          sign = hasZeroFactor ? 0 : 1;
+        }
+        else
+        {
+          sign = compareSign(a, a, 0, 1, exp);
+        }
+        if (sign == 0)
         {
           d_ms_proc[a] = true;
           Trace("nl-ext-debug")
@@ -308,7 +331,8 @@ int MonomialCheck::compareSign(
         args.emplace_back(oa);
         proof->addStep(lemma, PfRule::ARITH_MULT_SIGN, {}, args);
       }
-      d_data->d_im.addPendingLemma(lemma, InferenceId::ARITH_NL_SIGN, proof);
+      d_signLemmaCache.addLemma(
+          lemma, InferenceId::ARITH_NL_SIGN, proof, false);
     }
     return status;
   }
@@ -334,7 +358,8 @@ int MonomialCheck::compareSign(
         proof->addStep(conc, PfRule::MACRO_SR_PRED_INTRO, {prem}, {conc});
         proof->addStep(lemma, PfRule::SCOPE, {conc}, {prem});
       }
-      d_data->d_im.addPendingLemma(lemma, InferenceId::ARITH_NL_SIGN, proof);
+      d_signLemmaCache.addLemma(
+          lemma, InferenceId::ARITH_NL_SIGN, proof, false);
     }
     return 0;
   }
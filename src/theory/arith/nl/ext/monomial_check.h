@@ -17,6 +17,7 @@
 #define CVC5__THEORY__ARITH__NL__EXT__MONOMIAL_CHECK_H
 
 #include "expr/node.h"
+#include "theory/arith/nl/ext/lemma_cache.h"
 #include "theory/arith/nl/ext/monomial.h"
 #include "theory/theory_inference.h"
 
@@ -190,6 +191,8 @@ class MonomialCheck
   // list of monomials with factors whose model value is non-constant in model
   //  e.g. y*cos( x )
   std::map<Node, bool> d_m_nconst_factor;
+  /** The sign lemmas generated for each monomial */
+  LemmaCache d_signLemmaCache;
 };
 
 }  // namespace nl
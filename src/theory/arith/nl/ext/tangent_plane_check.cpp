@@ -29,7 +29,10 @@ namespace theory {
 namespace arith {
 namespace nl {
 
-TangentPlaneCheck::TangentPlaneCheck(ExtState* data) : d_data(data) {}
+TangentPlaneCheck::TangentPlaneCheck(ExtState* data)
+    : d_data(data), d_lemmaCache(data, "tangentPlanes")
+{
+}
 
 void TangentPlaneCheck::check(bool asWaitingLemmas)
 {
@@ -54,6 +57,23 @@ void TangentPlaneCheck::check(bool asWaitingLemmas)
     {
       continue;
     }
+    // the lemmas for t only depend on its decompositions and their values
+    std::vector<Node> sig;
+    for (const Node& tc : it->second)
+    {
+      if (tc != d_data->d_one)
+      {
+        sig.emplace_back(tc);
+        sig.emplace_back(d_data->d_model.computeAbstractModelValue(tc));
+        sig.emplace_back(d_data->d_model.computeAbstractModelValue(
+            d_data->d_mdb.getContainsDiffNl(tc, t)));
+      }
+    }
+    if (d_lemmaCache.replay(t, sig, asWaitingLemmas))
+    {
+      Trace("nl-ext-tplanes") << "  lemmas taken from cache" << std::endl;
+      continue;
+    }
     std::map<Node, std::map<Node, bool> > dproc;
     for (unsigned j = 0; j < it->second.size(); j++)
     {
@@ -151,10 +171,10 @@ void TangentPlaneCheck::check(bool asWaitingLemmas)
                                 b_v,
                                 nm->mkConst(Rational(d == 0 ? -1 : 1))});
               }
-              d_data->d_im.addPendingLemma(tlem,
-                                           InferenceId::ARITH_NL_TANGENT_PLANE,
-                                           proof,
-                                           asWaitingLemmas);
+              d_lemmaCache.addLemma(tlem,
+                                    InferenceId::ARITH_NL_TANGENT_PLANE,
+                                    proof,
+                                    asWaitingLemmas);
             }
           }
         }
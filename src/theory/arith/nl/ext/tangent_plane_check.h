@@ -19,6 +19,7 @@
 #include <map>
 
 #include "expr/node.h"
+#include "theory/arith/nl/ext/lemma_cache.h"
 
 namespace cvc5 {
 namespace theory {
@@ -63,6 +64,8 @@ class TangentPlaneCheck
   ExtState* d_data;
   /** tangent plane bounds */
   std::map<Node, std::map<Node, Node> > d_tangent_val_bound[4];
+  /** The lemmas generated for each monomial */
+  LemmaCache d_lemmaCache;
 };
 
 }  // namespace nl
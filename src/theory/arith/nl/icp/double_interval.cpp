@@ -0,0 +1,342 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2021 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Outward rounded intervals over doubles.
+ */
+
+#include "theory/arith/nl/icp/double_interval.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+#include "base/check.h"
+
+namespace cvc5 {
+namespace theory {
+namespace arith {
+namespace nl {
+namespace icp {
+
+namespace {
+
+constexpr double s_inf = std::numeric_limits<double>::infinity();
+constexpr double s_max = std::numeric_limits<double>::max();
+/**
+ * Below this magnitude, the error terms computed below may be inexact due to
+ * underflow, hence we always round outward.
+ */
+constexpr double s_tiny = 1e-290;
+
+/*
+ * The following functions compute a result of an operation on doubles and
+ * round it towards -oo (down) or +oo (up). Instead of changing the rounding
+ * mode, they compute the (exact) error of the rounded-to-nearest result using
+ * error-free transformations, and only move to the next double if the result
+ * was not exact. This keeps results exact whenever possible, in particular for
+ * integral values.
+ */
+
+/** Handle a result s that is infinite, for down and up rounding */
+double overflowDown(double s, bool exact)
+{
+  return (exact || s < 0) ? s : s_max;
+}
+double overflowUp(double s, bool exact)
+{
+  return (exact || s > 0) ? s : -s_max;
+}
+
+/** Round s down (resp. up), where the exact result is s + err */
+double roundDown(double s, double err)
+{
+  return err < 0 ? std::nextafter(s, -s_inf) : s;
+}
+double roundUp(double s, double err)
+{
+  return err > 0 ? std::nextafter(s, s_inf) : s;
+}
+
+/** The error of a + b, computed by the TwoSum algorithm */
+double addError(double a, double b, double s)
+{
+  double bb = s - a;
+  return (a - (s - bb)) + (b - bb);
+}
+
+double addDown(double a, double b)
+{
+  double s = a + b;
+  if (std::isinf(s))
+  {
+    return overflowDown(s, std::isinf(a) || std::isinf(b));
+  }
+  return roundDown(s, addError(a, b, s));
+}
+
+double addUp(double a, double b)
+{
+  double s = a + b;
+  if (std::isinf(s))
+  {
+    return overflowUp(s, std::isinf(a) || std::isinf(b));
+  }
+  return roundUp(s, addError(a, b, s));
+}
+
+double mulDown(double a, double b)
+{
+  if (a == 0 || b == 0) return 0;
+  double p = a * b;
+  if (std::isinf(p))
+  {
+    return overflowDown(p, std::isinf(a) || std::isinf(b));
+  }
+  if (std::fabs(p) < s_tiny) return std::nextafter(p, -s_inf);
+  return roundDown(p, std::fma(a, b, -p));
+}
+
+double mulUp(double a, double b)
+{
+  if (a == 0 || b == 0) return 0;
+  double p = a * b;
+  if (std::isinf(p))
+  {
+    return overflowUp(p, std::isinf(a) || std::isinf(b));
+  }
+  if (std::fabs(p) < s_tiny) return std::nextafter(p, s_inf);
+  return roundUp(p, std::fma(a, b, -p));
+}
+
+/**
+ * The sign of the error of q = a / b: the exact result is a / b = q + r / b
+ * with the remainder r = a - q * b.
+ */
+double divError(double a, double b, double q)
+{
+  double r = std::fma(-q, b, a);
+  return b < 0 ? -r : r;
+}
+
+double divDown(double a, double b)
+{
+  Assert(b != 0);
+  // near a corner where both bounds are infinite, the quotient takes every
+  // value of the sign of a / b
+  if (std::isinf(a) && std::isinf(b)) return (a > 0) == (b > 0) ? 0 : -s_inf;
+  double q = a / b;
+  if (std::isinf(a) || std::isinf(b)) return q;
+  if (std::isinf(q)) return overflowDown(q, false);
+  if (std::fabs(q) < s_tiny) return a == 0 ? q : std::nextafter(q, -s_inf);
+  return roundDown(q, divError(a, b, q));
+}
+
+double divUp(double a, double b)
+{
+  Assert(b != 0);
+  if (std::isinf(a) && std::isinf(b)) return (a > 0) == (b > 0) ? s_inf : 0;
+  double q = a / b;
+  if (std::isinf(a) || std::isinf(b)) return q;
+  if (std::isinf(q)) return overflowUp(q, false);
+  if (std::fabs(q) < s_tiny) return a == 0 ? q : std::nextafter(q, s_inf);
+  return roundUp(q, divError(a, b, q));
+}
+
+/** Square roots of a >= 0, the exact result is s + (a - s * s) / (2s) */
+double sqrtDown(double a)
+{
+  double s = std::sqrt(a);
+  if (std::isinf(s) || s == 0) return s;
+  if (s < s_tiny) return std::nextafter(s, -s_inf);
+  return roundDown(s, std::fma(-s, s, a));
+}
+
+double sqrtUp(double a)
+{
+  double s = std::sqrt(a);
+  if (std::isinf(s) || a == 0) return s;
+  if (s < s_tiny) return std::nextafter(s, s_inf);
+  return roundUp(s, std::fma(-s, s, a));
+}
+
+/** a^e for a >= 0, rounded down (resp. up) */
+double powDown(double a, uint32_t e)
+{
+  double res = 1;
+  for (uint32_t i = 0; i < e; ++i)
+  {
+    res = mulDown(res, a);
+  }
+  return res;
+}
+double powUp(double a, uint32_t e)
+{
+  double res = 1;
+  for (uint32_t i = 0; i < e; ++i)
+  {
+    res = mulUp(res, a);
+  }
+  return res;
+}
+
+}  // namespace
+
+DoubleInterval::DoubleInterval() : d_lower(-s_inf), d_upper(s_inf) {}
+
+DoubleInterval::DoubleInterval(double lower, double upper)
+    : d_lower(lower), d_upper(upper)
+{
+  Assert(!std::isnan(lower) && !std::isnan(upper));
+}
+
+DoubleInterval DoubleInterval::fromRational(const Rational& r)
+{
+  double d = r.getDouble();
+  Maybe<Rational> exact = Rational::fromDouble(d);
+  if (exact.just() && exact.value() == r)
+  {
+    return DoubleInterval(d, d);
+  }
+  // getDouble() is accurate up to one unit in the last place
+  return DoubleInterval(std::nextafter(d, -s_inf), std::nextafter(d, s_inf));
+}
+
+DoubleInterval DoubleInterval::mkEmpty()
+{
+  return DoubleInterval(s_inf, -s_inf);
+}
+
+bool DoubleInterval::isSubsetOf(const DoubleInterval& i) const
+{
+  return isEmpty() || (i.d_lower <= d_lower && d_upper <= i.d_upper);
+}
+
+bool DoubleInterval::operator==(const DoubleInterval& i) const
+{
+  if (isEmpty() || i.isEmpty())
+  {
+    return isEmpty() && i.isEmpty();
+  }
+  return d_lower == i.d_lower && d_upper == i.d_upper;
+}
+
+DoubleInterval DoubleInterval::intersect(const DoubleInterval& i) const
+{
+  return DoubleInterval(std::max(d_lower, i.d_lower),
+                        std::min(d_upper, i.d_upper));
+}
+
+DoubleInterval DoubleInterval::hull(const DoubleInterval& i) const
+{
+  if (isEmpty()) return i;
+  if (i.isEmpty()) return *this;
+  return DoubleInterval(std::min(d_lower, i.d_lower),
+                        std::max(d_upper, i.d_upper));
+}
+
+DoubleInterval DoubleInterval::integralHull() const
+{
+  if (isEmpty()) return *this;
+  return DoubleInterval(std::ceil(d_lower), std::floor(d_upper));
+}
+
+DoubleInterval DoubleInterval::operator-() const
+{
+  if (isEmpty()) return *this;
+  return DoubleInterval(-d_upper, -d_lower);
+}
+
+DoubleInterval DoubleInterval::operator+(const DoubleInterval& i) const
+{
+  if (isEmpty() || i.isEmpty()) return mkEmpty();
+  return DoubleInterval(addDown(d_lower, i.d_lower),
+                        addUp(d_upper, i.d_upper));
+}
+
+DoubleInterval DoubleInterval::operator-(const DoubleInterval& i) const
+{
+  return *this + (-i);
+}
+
+DoubleInterval DoubleInterval::operator*(const DoubleInterval& i) const
+{
+  if (isEmpty() || i.isEmpty()) return mkEmpty();
+  double lower = std::min({mulDown(d_lower, i.d_lower),
+                           mulDown(d_lower, i.d_upper),
+                           mulDown(d_upper, i.d_lower),
+                           mulDown(d_upper, i.d_upper)});
+  double upper = std::max({mulUp(d_lower, i.d_lower),
+                           mulUp(d_lower, i.d_upper),
+                           mulUp(d_upper, i.d_lower),
+                           mulUp(d_upper, i.d_upper)});
+  return DoubleInterval(lower, upper);
+}
+
+DoubleInterval DoubleInterval::operator/(const DoubleInterval& i) const
+{
+  if (isEmpty() || i.isEmpty()) return mkEmpty();
+  if (i.contains(0))
+  {
+    return DoubleInterval();
+  }
+  double lower = std::min({divDown(d_lower, i.d_lower),
+                           divDown(d_lower, i.d_upper),
+                           divDown(d_upper, i.d_lower),
+                           divDown(d_upper, i.d_upper)});
+  double upper = std::max({divUp(d_lower, i.d_lower),
+                           divUp(d_lower, i.d_upper),
+                           divUp(d_upper, i.d_lower),
+                           divUp(d_upper, i.d_upper)});
+  return DoubleInterval(lower, upper);
+}
+
+DoubleInterval DoubleInterval::pow(uint32_t e) const
+{
+  Assert(e > 0);
+  if (isEmpty() || e == 1) return *this;
+  if (e % 2 == 0)
+  {
+    // x^e = |x|^e is monotone in |x|
+    double mig =
+        contains(0) ? 0 : std::min(std::fabs(d_lower), std::fabs(d_upper));
+    double mag = std::max(std::fabs(d_lower), std::fabs(d_upper));
+    return DoubleInterval(powDown(mig, e), powUp(mag, e));
+  }
+  // x^e is monotone for odd e
+  double lower = d_lower >= 0 ? powDown(d_lower, e) : -powUp(-d_lower, e);
+  double upper = d_upper >= 0 ? powUp(d_upper, e) : -powDown(-d_upper, e);
+  return DoubleInterval(lower, upper);
+}
+
+DoubleInterval DoubleInterval::sqrtInverse(const DoubleInterval& current) const
+{
+  DoubleInterval sq = intersect(DoubleInterval(0, s_inf));
+  if (sq.isEmpty()) return sq;
+  double lower = sqrtDown(sq.d_lower);
+  double upper = sqrtUp(sq.d_upper);
+  DoubleInterval pos = DoubleInterval(lower, upper).intersect(current);
+  DoubleInterval neg = DoubleInterval(-upper, -lower).intersect(current);
+  return pos.hull(neg);
+}
+
+std::ostream& operator<<(std::ostream& os, const DoubleInterval& i)
+{
+  if (i.isEmpty())
+  {
+    return os << "empty";
+  }
+  return os << "[" << i.lower() << ", " << i.upper() << "]";
+}
+
+}  // namespace icp
+}  // namespace nl
+}  // namespace arith
+}  // namespace theory
+}  // namespace cvc5
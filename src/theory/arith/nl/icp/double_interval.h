@@ -0,0 +1,104 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2021 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Outward rounded intervals over doubles.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__THEORY__ARITH__NL__ICP__DOUBLE_INTERVAL_H
+#define CVC5__THEORY__ARITH__NL__ICP__DOUBLE_INTERVAL_H
+
+#include <cstdint>
+#include <iosfwd>
+
+#include "util/rational.h"
+
+namespace cvc5 {
+namespace theory {
+namespace arith {
+namespace nl {
+namespace icp {
+
+/**
+ * A closed interval [lower, upper] over doubles, where the bounds may be
+ * infinite. All operations round outward, that is every lower bound is
+ * rounded towards -oo and every upper bound towards +oo, such that the result
+ * of an operation always contains the exact result over the reals. Strict
+ * bounds are not represented, which makes all operations relaxations.
+ *
+ * An interval is empty if its lower bound is larger than its upper bound.
+ */
+class DoubleInterval
+{
+ public:
+  /** Construct the interval (-oo, +oo) */
+  DoubleInterval();
+  /** Construct the interval [lower, upper] */
+  DoubleInterval(double lower, double upper);
+  /**
+   * Construct the smallest interval containing r. This is the point interval
+   * if r is exactly representable as a double.
+   */
+  static DoubleInterval fromRational(const Rational& r);
+  /** Construct an empty interval */
+  static DoubleInterval mkEmpty();
+
+  double lower() const { return d_lower; }
+  double upper() const { return d_upper; }
+  bool isEmpty() const { return d_lower > d_upper; }
+  bool isPoint() const { return d_lower == d_upper; }
+  bool contains(double d) const { return d_lower <= d && d <= d_upper; }
+  /** Is this interval contained in i? */
+  bool isSubsetOf(const DoubleInterval& i) const;
+  bool operator==(const DoubleInterval& i) const;
+  bool operator!=(const DoubleInterval& i) const { return !(*this == i); }
+
+  /** The intersection of this interval and i */
+  DoubleInterval intersect(const DoubleInterval& i) const;
+  /** The smallest interval containing this interval and i */
+  DoubleInterval hull(const DoubleInterval& i) const;
+  /**
+   * Round the bounds inward to integers, as required for integral variables.
+   */
+  DoubleInterval integralHull() const;
+
+  DoubleInterval operator-() const;
+  DoubleInterval operator+(const DoubleInterval& i) const;
+  DoubleInterval operator-(const DoubleInterval& i) const;
+  DoubleInterval operator*(const DoubleInterval& i) const;
+  /**
+   * Division. If i contains zero, the result is (-oo, +oo), which is a sound
+   * (albeit weak) over-approximation for the purposes of contraction.
+   */
+  DoubleInterval operator/(const DoubleInterval& i) const;
+  /** Raise this interval to the power of e > 0 */
+  DoubleInterval pow(uint32_t e) const;
+  /**
+   * Compute an interval containing all x in current such that x^2 is in this
+   * interval.
+   */
+  DoubleInterval sqrtInverse(const DoubleInterval& current) const;
+
+ private:
+  /** The lower bound */
+  double d_lower;
+  /** The upper bound */
+  double d_upper;
+};
+
+std::ostream& operator<<(std::ostream& os, const DoubleInterval& i);
+
+}  // namespace icp
+}  // namespace nl
+}  // namespace arith
+}  // namespace theory
+}  // namespace cvc5
+
+#endif /* CVC5__THEORY__ARITH__NL__ICP__DOUBLE_INTERVAL_H */
@@ -0,0 +1,488 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2021 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * An ICP solver based on HC4 revise over double intervals.
+ */
+
+#include "theory/arith/nl/icp/hc4_solver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <limits>
+
+#include "base/check.h"
+#include "base/output.h"
+#include "smt/smt_statistics_registry.h"
+#include "theory/arith/inference_manager.h"
+#include "theory/rewriter.h"
+
+namespace cvc5 {
+namespace theory {
+namespace arith {
+namespace nl {
+namespace icp {
+
+namespace {
+
+constexpr double s_inf = std::numeric_limits<double>::infinity();
+
+/**
+ * Whether the contraction of a domain from old to cur is worth revising the
+ * constraints of the variable again. This is the case if a bound became
+ * finite, or if the width decreased by at least ten percent.
+ */
+bool isSignificant(const DoubleInterval& old, const DoubleInterval& cur)
+{
+  if ((std::isinf(old.lower()) && !std::isinf(cur.lower()))
+      || (std::isinf(old.upper()) && !std::isinf(cur.upper())))
+  {
+    return true;
+  }
+  double oldWidth = old.upper() - old.lower();
+  double curWidth = cur.upper() - cur.lower();
+  return curWidth < 0.9 * oldWidth;
+}
+
+}  // namespace
+
+HC4Solver::Statistics::Statistics()
+    : d_revisions(smtStatisticsRegistry().registerInt("nl::hc4::revisions")),
+      d_conflicts(smtStatisticsRegistry().registerInt("nl::hc4::conflicts")),
+      d_lemmas(smtStatisticsRegistry().registerInt("nl::hc4::lemmas")),
+      d_checkTime(smtStatisticsRegistry().registerTimer("nl::hc4::checkTime"))
+{
+}
+
+HC4Solver::HC4Solver(InferenceManager& im) : d_im(im) {}
+
+void HC4Solver::reset(const std::vector<Node>& assertions)
+{
+  d_dag.clear();
+  d_dagIndex.clear();
+  d_constraints.clear();
+  d_varConstraints.clear();
+  for (const Node& n : assertions)
+  {
+    addConstraint(n);
+  }
+}
+
+size_t HC4Solver::mkDagNode(TNode n)
+{
+  auto it = d_dagIndex.find(n);
+  if (it != d_dagIndex.end())
+  {
+    return it->second;
+  }
+  Kind k = n.getKind();
+  size_t id;
+  if (k == Kind::PLUS || k == Kind::MULT || k == Kind::NONLINEAR_MULT)
+  {
+    std::vector<std::pair<size_t, uint32_t>> children;
+    for (TNode c : n)
+    {
+      size_t cid = mkDagNode(c);
+      auto cit = std::find_if(
+          children.begin(), children.end(), [cid](const auto& child) {
+            return child.first == cid;
+          });
+      if (k != Kind::PLUS && cit != children.end())
+      {
+        // repeated factors are represented by their exponent
+        ++cit->second;
+      }
+      else
+      {
+        children.emplace_back(cid, 1);
+      }
+    }
+    id = mkDagNode(k == Kind::PLUS ? Kind::PLUS : Kind::MULT, children);
+  }
+  else
+  {
+    id = d_dag.size();
+    d_dag.emplace_back();
+    DagNode& dn = d_dag.back();
+    if (k == Kind::CONST_RATIONAL)
+    {
+      dn.d_kind = Kind::CONST_RATIONAL;
+      dn.d_interval = DoubleInterval::fromRational(n.getConst<Rational>());
+    }
+    else
+    {
+      // anything else is treated as a variable
+      dn.d_kind = Kind::UNDEFINED_KIND;
+      dn.d_var = n;
+      dn.d_integral = n.getType().isInteger();
+    }
+  }
+  d_dagIndex.emplace(n, id);
+  return id;
+}
+
+size_t HC4Solver::mkDagNode(Kind k,
+                            const std::vector<std::pair<size_t, uint32_t>>& c)
+{
+  Assert(k == Kind::PLUS || k == Kind::MULT);
+  d_dag.emplace_back();
+  d_dag.back().d_kind = k;
+  d_dag.back().d_children = c;
+  return d_dag.size() - 1;
+}
+
+void HC4Solver::addConstraint(TNode lit)
+{
+  bool negated = lit.getKind() == Kind::NOT;
+  TNode atom = negated ? lit[0] : lit;
+  // strict inequalities are relaxed to weak ones
+  DoubleInterval nonneg(0, s_inf);
+  DoubleInterval nonpos(-s_inf, 0);
+  Constraint c;
+  c.d_origin = lit;
+  switch (atom.getKind())
+  {
+    case Kind::GEQ:
+    case Kind::GT: c.d_range = negated ? nonpos : nonneg; break;
+    case Kind::LEQ:
+    case Kind::LT: c.d_range = negated ? nonneg : nonpos; break;
+    case Kind::EQUAL:
+      if (negated || !atom[0].getType().isReal())
+      {
+        return;
+      }
+      c.d_range = DoubleInterval(0, 0);
+      break;
+    default: return;
+  }
+  if (atom[1].getKind() == Kind::CONST_RATIONAL)
+  {
+    // t ~ c is t - c ~ 0, hence the range of t is shifted by c
+    c.d_root = mkDagNode(atom[0]);
+    c.d_range =
+        c.d_range + DoubleInterval::fromRational(atom[1].getConst<Rational>());
+  }
+  else
+  {
+    NodeManager* nm = NodeManager::currentNM();
+    size_t lhs = mkDagNode(atom[0]);
+    size_t rhs = mkDagNode(atom[1]);
+    size_t minusOne = mkDagNode(nm->mkConst(Rational(-1)));
+    size_t negRhs = mkDagNode(Kind::MULT, {{minusOne, 1}, {rhs, 1}});
+    c.d_root = mkDagNode(Kind::PLUS, {{lhs, 1}, {negRhs, 1}});
+  }
+
+  // collect the nodes of t in post-order
+  std::vector<bool> visited(d_dag.size(), false);
+  std::vector<std::pair<size_t, size_t>> visit = {{c.d_root, 0}};
+  visited[c.d_root] = true;
+  while (!visit.empty())
+  {
+    auto& [id, next] = visit.back();
+    const DagNode& dn = d_dag[id];
+    if (next < dn.d_children.size())
+    {
+      size_t cid = dn.d_children[next++].first;
+      if (!visited[cid])
+      {
+        visited[cid] = true;
+        visit.emplace_back(cid, 0);
+      }
+      continue;
+    }
+    if (dn.d_kind == Kind::UNDEFINED_KIND)
+    {
+      c.d_vars.emplace_back(id);
+    }
+    else if (dn.d_kind == Kind::MULT)
+    {
+      uint32_t degree = 0;
+      for (const auto& child : dn.d_children)
+      {
+        if (d_dag[child.first].d_kind != Kind::CONST_RATIONAL)
+        {
+          degree += child.second;
+        }
+      }
+      c.d_nonlinear = c.d_nonlinear || degree > 1;
+    }
+    c.d_nodes.emplace_back(id);
+    visit.pop_back();
+  }
+  Trace("nl-icp-hc4") << "Constraint " << lit << " with " << c.d_vars.size()
+                      << " variables, nonlinear: " << c.d_nonlinear
+                      << std::endl;
+  for (size_t v : c.d_vars)
+  {
+    d_varConstraints[v].emplace_back(d_constraints.size());
+  }
+  d_constraints.emplace_back(std::move(c));
+}
+
+void HC4Solver::evaluate(size_t id)
+{
+  DagNode& dn = d_dag[id];
+  if (dn.d_kind == Kind::PLUS)
+  {
+    DoubleInterval res(0, 0);
+    for (const auto& child : dn.d_children)
+    {
+      res = res + d_dag[child.first].d_interval;
+    }
+    dn.d_interval = res;
+  }
+  else if (dn.d_kind == Kind::MULT)
+  {
+    DoubleInterval res(1, 1);
+    for (const auto& child : dn.d_children)
+    {
+      res = res * d_dag[child.first].d_interval.pow(child.second);
+    }
+    dn.d_interval = res;
+  }
+}
+
+bool HC4Solver::contract(
+    size_t id,
+    const DoubleInterval& i,
+    std::vector<std::pair<size_t, DoubleInterval>>& changed)
+{
+  DagNode& dn = d_dag[id];
+  DoubleInterval res = dn.d_interval.intersect(i);
+  if (dn.d_integral)
+  {
+    res = res.integralHull();
+  }
+  if (res.isEmpty())
+  {
+    return false;
+  }
+  // constants are shared by all constraints, hence we never contract them
+  if (dn.d_kind != Kind::CONST_RATIONAL && res != dn.d_interval)
+  {
+    if (dn.d_kind == Kind::UNDEFINED_KIND)
+    {
+      changed.emplace_back(id, dn.d_interval);
+    }
+    dn.d_interval = res;
+  }
+  return true;
+}
+
+bool HC4Solver::project(size_t id,
+                        std::vector<std::pair<size_t, DoubleInterval>>& changed)
+{
+  const DagNode& dn = d_dag[id];
+  if (dn.d_kind != Kind::PLUS && dn.d_kind != Kind::MULT)
+  {
+    return true;
+  }
+  bool isPlus = dn.d_kind == Kind::PLUS;
+  DoubleInterval interval = dn.d_interval;
+  std::vector<std::pair<size_t, uint32_t>> children = dn.d_children;
+  size_t n = children.size();
+  // prefix[i] (suffix[i]) combines the children before (after) child i
+  DoubleInterval neutral = isPlus ? DoubleInterval(0, 0) : DoubleInterval(1, 1);
+  std::vector<DoubleInterval> prefix(n + 1, neutral);
+  std::vector<DoubleInterval> suffix(n + 1, neutral);
+  for (size_t i = 0; i < n; ++i)
+  {
+    const DoubleInterval& ci = d_dag[children[i].first].d_interval;
+    const DoubleInterval& cj = d_dag[children[n - 1 - i].first].d_interval;
+    if (isPlus)
+    {
+      prefix[i + 1] = prefix[i] + ci;
+      suffix[n - 1 - i] = suffix[n - i] + cj;
+    }
+    else
+    {
+      prefix[i + 1] = prefix[i] * ci.pow(children[i].second);
+      suffix[n - 1 - i] = suffix[n - i] * cj.pow(children[n - 1 - i].second);
+    }
+  }
+  for (size_t i = 0; i < n; ++i)
+  {
+    size_t cid = children[i].first;
+    if (isPlus)
+    {
+      // c_i = t - (sum of the other children)
+      if (!contract(cid, interval - (prefix[i] + suffix[i + 1]), changed))
+      {
+        return false;
+      }
+      continue;
+    }
+    // c_i^e = t / (product of the other children)
+    DoubleInterval rest = prefix[i] * suffix[i + 1];
+    if (rest.contains(0))
+    {
+      continue;
+    }
+    DoubleInterval quotient = interval / rest;
+    if (children[i].second == 1)
+    {
+      if (!contract(cid, quotient, changed))
+      {
+        return false;
+      }
+    }
+    else if (children[i].second == 2)
+    {
+      DoubleInterval root = quotient.sqrtInverse(d_dag[cid].d_interval);
+      if (root.isEmpty() || !contract(cid, root, changed))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool HC4Solver::revise(const Constraint& c,
+                       std::vector<std::pair<size_t, DoubleInterval>>& changed)
+{
+  ++d_stats.d_revisions;
+  for (size_t id : c.d_nodes)
+  {
+    evaluate(id);
+  }
+  if (!contract(c.d_root, c.d_range, changed))
+  {
+    return false;
+  }
+  for (auto it = c.d_nodes.rbegin(); it != c.d_nodes.rend(); ++it)
+  {
+    if (!project(*it, changed))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::set<Node> HC4Solver::getOrigins(const Constraint& c) const
+{
+  std::set<Node> res = {c.d_origin};
+  for (size_t v : c.d_vars)
+  {
+    res.insert(d_dag[v].d_origins.begin(), d_dag[v].d_origins.end());
+  }
+  return res;
+}
+
+void HC4Solver::check()
+{
+  TimerStat::CodeTimer checkTimer(d_stats.d_checkTime);
+  std::deque<size_t> queue;
+  std::vector<bool> queued(d_constraints.size(), true);
+  for (size_t i = 0, n = d_constraints.size(); i < n; ++i)
+  {
+    queue.emplace_back(i);
+  }
+  size_t budget = d_revisionsPerConstraint * d_constraints.size();
+  std::vector<std::pair<size_t, DoubleInterval>> changed;
+  while (!queue.empty() && budget > 0)
+  {
+    --budget;
+    size_t cid = queue.front();
+    queue.pop_front();
+    queued[cid] = false;
+    const Constraint& c = d_constraints[cid];
+    changed.clear();
+    if (!revise(c, changed))
+    {
+      std::set<Node> origins = getOrigins(c);
+      Trace("nl-icp-hc4") << "Conflict from " << c.d_origin << ", origins "
+                          << origins.size() << std::endl;
+      std::vector<Node> mis;
+      for (const Node& o : origins)
+      {
+        mis.emplace_back(o.negate());
+      }
+      ++d_stats.d_conflicts;
+      d_im.addPendingLemma(NodeManager::currentNM()->mkOr(mis),
+                           InferenceId::ARITH_NL_ICP_CONFLICT);
+      return;
+    }
+    if (changed.empty())
+    {
+      continue;
+    }
+    std::set<Node> origins = getOrigins(c);
+    bool nonlinear = c.d_nonlinear;
+    for (size_t v : c.d_vars)
+    {
+      nonlinear = nonlinear || d_dag[v].d_nonlinearOrigin;
+    }
+    for (const auto& [vid, old] : changed)
+    {
+      DagNode& dn = d_dag[vid];
+      dn.d_origins.insert(origins.begin(), origins.end());
+      dn.d_nonlinearOrigin = dn.d_nonlinearOrigin || nonlinear;
+      Trace("nl-icp-hc4") << dn.d_var << " : " << old << " -> "
+                          << dn.d_interval << std::endl;
+      if (!isSignificant(old, dn.d_interval))
+      {
+        continue;
+      }
+      for (size_t other : d_varConstraints[vid])
+      {
+        if (!queued[other])
+        {
+          queued[other] = true;
+          queue.emplace_back(other);
+        }
+      }
+    }
+  }
+  sendBoundLemmas();
+}
+
+void HC4Solver::sendBoundLemmas()
+{
+  NodeManager* nm = NodeManager::currentNM();
+  for (const DagNode& dn : d_dag)
+  {
+    // bounds that only rely on linear constraints are left to the linear
+    // solver
+    if (dn.d_kind != Kind::UNDEFINED_KIND || !dn.d_nonlinearOrigin)
+    {
+      continue;
+    }
+    Node premise =
+        nm->mkAnd(std::vector<Node>(dn.d_origins.begin(), dn.d_origins.end()));
+    for (bool isLower : {true, false})
+    {
+      double b = isLower ? dn.d_interval.lower() : dn.d_interval.upper();
+      if (std::isinf(b))
+      {
+        continue;
+      }
+      // doubles are exactly representable as rationals
+      Node bound = nm->mkConst(Rational::fromDouble(b).value());
+      Node lit = Rewriter::rewrite(
+          nm->mkNode(isLower ? Kind::GEQ : Kind::LEQ, dn.d_var, bound));
+      if (lit.isConst() || dn.d_origins.find(lit) != dn.d_origins.end())
+      {
+        continue;
+      }
+      Trace("nl-icp-hc4") << "Bound " << lit << " from " << premise
+                          << std::endl;
+      ++d_stats.d_lemmas;
+      d_im.addPendingLemma(nm->mkNode(Kind::IMPLIES, premise, lit),
+                           InferenceId::ARITH_NL_ICP_PROPAGATION);
+    }
+  }
+}
+
+}  // namespace icp
+}  // namespace nl
+}  // namespace arith
+}  // namespace theory
+}  // namespace cvc5
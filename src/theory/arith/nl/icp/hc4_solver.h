@@ -0,0 +1,168 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2021 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * An ICP solver based on HC4 revise over double intervals.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__THEORY__ARITH__NL__ICP__HC4_SOLVER_H
+#define CVC5__THEORY__ARITH__NL__ICP__HC4_SOLVER_H
+
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "expr/node.h"
+#include "theory/arith/nl/icp/double_interval.h"
+#include "util/statistics_stats.h"
+
+namespace cvc5 {
+namespace theory {
+namespace arith {
+
+class InferenceManager;
+
+namespace nl {
+namespace icp {
+
+/**
+ * This class implements interval constraint propagation with the HC4 revise
+ * operator. Unlike ICPSolver, it does not depend on libpoly, as it uses
+ * outward rounded double intervals (see DoubleInterval).
+ *
+ * The terms of all arithmetic literals are stored in a DAG that shares common
+ * subterms. HC4 revise of a constraint t ~ 0 first evaluates the intervals of
+ * all nodes of t bottom-up, intersects the interval of t with the interval
+ * given by ~ 0, and then projects the intervals top-down onto the children of
+ * every node, contracting the intervals of the variables. Constraints are
+ * revised from a worklist: whenever the interval of a variable contracts
+ * significantly, all constraints containing it are revised again.
+ *
+ * Like ICPSolver, it only performs contractions and does not issue splits. A
+ * conflict is sent as a lemma immediately, while the improved variable bounds
+ * are sent as lemmas in a single batch once propagation has finished.
+ */
+class HC4Solver
+{
+ public:
+  HC4Solver(InferenceManager& im);
+  /** Reset this solver for the next theory call */
+  void reset(const std::vector<Node>& assertions);
+  /** Performs a full ICP check */
+  void check();
+
+ private:
+  /** A node of the DAG */
+  struct DagNode
+  {
+    /** PLUS, MULT, CONST_RATIONAL or UNDEFINED_KIND for variables */
+    Kind d_kind;
+    /**
+     * The children of this node, each with an exponent that may be larger
+     * than one only for MULT.
+     */
+    std::vector<std::pair<size_t, uint32_t>> d_children;
+    /**
+     * The current interval. For variables, this is the current domain, for
+     * all other nodes it is computed by the last bottom-up evaluation.
+     */
+    DoubleInterval d_interval;
+    /** The variable, if this node is a variable */
+    Node d_var;
+    /** Whether this node is an integral variable */
+    bool d_integral = false;
+    /** The literals the domain of this variable was derived from */
+    std::set<Node> d_origins;
+    /** Whether d_origins contains a nonlinear constraint */
+    bool d_nonlinearOrigin = false;
+  };
+  /** A constraint t ~ 0 */
+  struct Constraint
+  {
+    /** The literal this constraint was constructed from */
+    Node d_origin;
+    /** The DAG node for t */
+    size_t d_root;
+    /** The interval given by ~ 0 */
+    DoubleInterval d_range;
+    /** The DAG nodes of t, children before their parents */
+    std::vector<size_t> d_nodes;
+    /** The variables of t */
+    std::vector<size_t> d_vars;
+    /** Whether t contains a nonlinear multiplication */
+    bool d_nonlinear = false;
+  };
+
+  /** Get the DAG node for term n, constructing it if necessary */
+  size_t mkDagNode(TNode n);
+  /** Add a new DAG node that does not correspond to a term */
+  size_t mkDagNode(Kind k, const std::vector<std::pair<size_t, uint32_t>>& c);
+  /** Add the constraint for literal lit, if it is an arithmetic literal */
+  void addConstraint(TNode lit);
+  /** Evaluate the interval of DAG node id from its children */
+  void evaluate(size_t id);
+  /**
+   * Intersect the interval of DAG node id with i. Returns false if the result
+   * is empty. Adds id to changed if it is a variable whose domain changed.
+   */
+  bool contract(size_t id,
+                const DoubleInterval& i,
+                std::vector<std::pair<size_t, DoubleInterval>>& changed);
+  /** Project the interval of DAG node id onto its children */
+  bool project(size_t id,
+               std::vector<std::pair<size_t, DoubleInterval>>& changed);
+  /**
+   * Apply HC4 revise to constraint c. Returns false if a conflict was found.
+   * Adds all variables whose domain changed, with their old domain, to
+   * changed.
+   */
+  bool revise(const Constraint& c,
+              std::vector<std::pair<size_t, DoubleInterval>>& changed);
+  /** Get the literals that the constraint c in the current domains relies on */
+  std::set<Node> getOrigins(const Constraint& c) const;
+  /** Send the lemmas for all variable bounds derived from nonlinear terms */
+  void sendBoundLemmas();
+
+  /** The inference manager */
+  InferenceManager& d_im;
+  /** The DAG */
+  std::vector<DagNode> d_dag;
+  /** Maps terms to their DAG node */
+  std::unordered_map<Node, size_t> d_dagIndex;
+  /** The constraints */
+  std::vector<Constraint> d_constraints;
+  /** Maps DAG nodes of variables to the constraints they occur in */
+  std::unordered_map<size_t, std::vector<size_t>> d_varConstraints;
+  /** The number of revisions allowed per constraint and check */
+  static constexpr size_t d_revisionsPerConstraint = 20;
+
+  struct Statistics
+  {
+    /** Number of calls to revise */
+    IntStat d_revisions;
+    /** Number of conflicts found */
+    IntStat d_conflicts;
+    /** Number of bound lemmas sent */
+    IntStat d_lemmas;
+    /** Time spent in check */
+    TimerStat d_checkTime;
+    Statistics();
+  };
+  Statistics d_stats;
+};
+
+}  // namespace icp
+}  // namespace nl
+}  // namespace arith
+}  // namespace theory
+}  // namespace cvc5
+
+#endif /* CVC5__THEORY__ARITH__NL__ICP__HC4_SOLVER_H */
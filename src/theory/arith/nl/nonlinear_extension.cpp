@@ -59,6 +59,7 @@ NonlinearExtension::NonlinearExtension(TheoryArith& containing,
       d_tangentPlaneSlv(&d_extState),
       d_cadSlv(d_im, d_model, state.getUserContext(), pnm),
       d_icpSlv(d_im),
+      d_hc4Slv(d_im),
       d_iandSlv(d_im, state, d_model),
       d_pow2Slv(d_im, state, d_model)
 {
@@ -556,6 +557,7 @@ void NonlinearExtension::runStrategy(Theory::Effort effort,
   {
     InferStep step = steps.next();
     Trace("nl-strategy") << "Step " << step << std::endl;
+    TimerStat::CodeTimer stepTimer(d_stats.getStepTimer(step));
     switch (step)
     {
       case InferStep::BREAK: stop = d_im.hasPendingLemma(); break;
@@ -576,8 +578,16 @@ void NonlinearExtension::runStrategy(Theory::Effort effort,
       case InferStep::POW2_FULL: d_pow2Slv.checkFullRefine(); break;
       case InferStep::POW2_INITIAL: d_pow2Slv.checkInitialRefine(); break;
       case InferStep::ICP:
-        d_icpSlv.reset(assertions);
-        d_icpSlv.check();
+        if (options::nlICPHC4())
+        {
+          d_hc4Slv.reset(assertions);
+          d_hc4Slv.check();
+        }
+        else
+        {
+          d_icpSlv.reset(assertions);
+          d_icpSlv.check();
+        }
         break;
       case InferStep::NL_INIT:
         d_extState.init(xts);
@@ -31,6 +31,7 @@
 #include "theory/arith/nl/ext/tangent_plane_check.h"
 #include "theory/arith/nl/ext_theory_callback.h"
 #include "theory/arith/nl/iand_solver.h"
+#include "theory/arith/nl/icp/hc4_solver.h"
 #include "theory/arith/nl/icp/icp_solver.h"
 #include "theory/arith/nl/nl_model.h"
 #include "theory/arith/nl/pow2_solver.h"
@@ -271,6 +272,8 @@ class NonlinearExtension
   CadSolver d_cadSlv;
   /** The ICP-based solver */
   icp::ICPSolver d_icpSlv;
+  /** The ICP-based solver over double intervals */
+  icp::HC4Solver d_hc4Slv;
   /** The integer and solver
    *
    * This is the subsolver responsible for running the procedure for
@@ -15,6 +15,8 @@
 
 #include "theory/arith/nl/stats.h"
 
+#include <sstream>
+
 #include "smt/smt_statistics_registry.h"
 
 namespace cvc5 {
@@ -28,6 +30,20 @@ NlStats::NlStats()
 {
 }
 
+TimerStat& NlStats::getStepTimer(InferStep step)
+{
+  auto it = d_stepTimers.find(step);
+  if (it == d_stepTimers.end())
+  {
+    std::stringstream ss;
+    ss << "nl::stepTime::" << step;
+    it = d_stepTimers
+             .emplace(step, smtStatisticsRegistry().registerTimer(ss.str()))
+             .first;
+  }
+  return it->second;
+}
+
 }  // namespace nl
 }  // namespace arith
 }  // namespace theory
@@ -18,6 +18,9 @@
 #ifndef CVC5__THEORY__ARITH__NL__STATS_H
 #define CVC5__THEORY__ARITH__NL__STATS_H
 
+#include <map>
+
+#include "theory/arith/nl/strategy.h"
 #include "util/statistics_stats.h"
 
 namespace cvc5 {
@@ -39,6 +42,12 @@ class NlStats
   IntStat d_mbrRuns;
   /** Number of calls to NonlinearExtension::checkLastCall */
   IntStat d_checkRuns;
+  /** Get the timer for the given step of the strategy */
+  TimerStat& getStepTimer(InferStep step);
+
+ private:
+  /** The timers for the steps of the strategy, registered on first use */
+  std::map<InferStep, TimerStat> d_stepTimers;
 };
 
 }  // namespace nl
@@ -43,6 +43,33 @@ Info::~Info() {
   in_stores->deleteSelf();
 }
 
+std::unordered_map<Node, size_t>& Info::getPositions(const CTNodeList* l)
+{
+  if (l == indices)
+  {
+    return d_indicesPos;
+  }
+  else if (l == stores)
+  {
+    return d_storesPos;
+  }
+  Assert(l == in_stores);
+  return d_inStoresPos;
+}
+
+bool Info::addToList(CTNodeList* l, TNode el)
+{
+  std::unordered_map<Node, size_t>& pos = getPositions(l);
+  std::unordered_map<Node, size_t>::iterator it = pos.find(el);
+  if (it != pos.end() && it->second < l->size() && (*l)[it->second] == el)
+  {
+    return false;
+  }
+  pos[el] = l->size();
+  l->push_back(el);
+  return true;
+}
+
 ArrayInfo::ArrayInfo(context::Context* c,
                      Backtracker<TNode>* b,
                      std::string statisticsPrefix)
@@ -82,16 +109,6 @@ ArrayInfo::~ArrayInfo() {
   delete emptyInfo;
 }
 
-bool inList(const CTNodeList* l, const TNode el) {
-  CTNodeList::const_iterator it = l->begin();
-  for (; it != l->end(); ++it)
-  {
-    if(*it == el)
-      return true;
-  }
-  return false;
-}
-
 void printList (CTNodeList* list) {
   CTNodeList::const_iterator it = list->begin();
   Trace("arrays-info")<<"   [ ";
@@ -112,19 +129,13 @@ void printList (List<TNode>* list) {
   Trace("arrays-info")<<"] \n";
 }
 
-void ArrayInfo::mergeLists(CTNodeList* la, const CTNodeList* lb) const{
-  std::set<TNode> temp;
-  CTNodeList::const_iterator it;
-  for (it = la->begin(); it != la->end(); ++it)
-  {
-    temp.insert((*it));
-  }
-
-  for (it = lb->begin(); it != lb->end(); ++it)
+void ArrayInfo::mergeLists(Info* ia,
+                           CTNodeList* la,
+                           const CTNodeList* lb) const
+{
+  for (CTNodeList::const_iterator it = lb->begin(); it != lb->end(); ++it)
   {
-    if(temp.count(*it) == 0) {
-      la->push_back(*it);
-    }
+    ia->addToList(la, *it);
   }
 }
 
@@ -133,20 +144,16 @@ void ArrayInfo::addIndex(const Node a, const TNode i) {
   Assert(!i.getType().isArray());  // temporary for flat arrays
 
   Trace("arrays-ind")<<"Arrays::addIndex "<<a<<"["<<i<<"]\n";
-  CTNodeList* temp_indices;
   Info* temp_info;
 
   CNodeInfoMap::iterator it = info_map.find(a);
   if(it == info_map.end()) {
     temp_info = new Info(ct, bck);
-    temp_indices = temp_info->indices;
-    temp_indices->push_back(i);
+    temp_info->addToList(temp_info->indices, i);
     info_map[a] = temp_info;
   } else {
-    temp_indices = (*it).second->indices;
-    if (! inList(temp_indices, i)) {
-      temp_indices->push_back(i);
-    }
+    temp_info = (*it).second;
+    temp_info->addToList(temp_info->indices, i);
   }
   if(Trace.isOn("arrays-ind")) {
     printList((*(info_map.find(a))).second->indices);
@@ -158,20 +165,16 @@ void ArrayInfo::addStore(const Node a, const TNode st){
   Assert(a.getType().isArray());
   Assert(st.getKind() == kind::STORE);  // temporary for flat arrays
 
-  CTNodeList* temp_store;
   Info* temp_info;
 
   CNodeInfoMap::iterator it = info_map.find(a);
   if(it == info_map.end()) {
     temp_info = new Info(ct, bck);
-    temp_store = temp_info->stores;
-    temp_store->push_back(st);
+    temp_info->addToList(temp_info->stores, st);
     info_map[a]=temp_info;
   } else {
-    temp_store = (*it).second->stores;
-    if(! inList(temp_store, st)) {
-      temp_store->push_back(st);
-    }
+    temp_info = (*it).second;
+    temp_info->addToList(temp_info->stores, st);
   }
 };
 
@@ -181,20 +184,16 @@ void ArrayInfo::addInStore(const TNode a, const TNode b){
   Assert(a.getType().isArray());
   Assert(b.getType().isArray());
 
-  CTNodeList* temp_inst;
   Info* temp_info;
 
   CNodeInfoMap::iterator it = info_map.find(a);
   if(it == info_map.end()) {
     temp_info = new Info(ct, bck);
-    temp_inst = temp_info->in_stores;
-    temp_inst->push_back(b);
+    temp_info->addToList(temp_info->in_stores, b);
     info_map[a] = temp_info;
   } else {
-    temp_inst = (*it).second->in_stores;
-    if(! inList(temp_inst, b)) {
-      temp_inst->push_back(b);
-    }
+    temp_info = (*it).second;
+    temp_info->addToList(temp_info->in_stores, b);
   }
 };
 
@@ -454,9 +453,9 @@ void ArrayInfo::mergeInfo(const TNode a, const TNode b){
       CTNodeList* listb_st = (*itb).second->stores;
       CTNodeList* listb_inst = (*itb).second->in_stores;
 
-      mergeLists(lista_i, listb_i);
-      mergeLists(lista_st, listb_st);
-      mergeLists(lista_inst, listb_inst);
+      mergeLists((*ita).second, lista_i, listb_i);
+      mergeLists((*ita).second, lista_st, listb_st);
+      mergeLists((*ita).second, lista_inst, listb_inst);
 
       /* sketchy stats */
 
@@ -499,9 +498,9 @@ void ArrayInfo::mergeInfo(const TNode a, const TNode b){
 
       Info* temp_info = new Info(ct, bck);
 
-      mergeLists(temp_info->indices, listb_i);
-      mergeLists(temp_info->stores, listb_st);
-      mergeLists(temp_info->in_stores, listb_inst);
+      mergeLists(temp_info, temp_info->indices, listb_i);
+      mergeLists(temp_info, temp_info->stores, listb_st);
+      mergeLists(temp_info, temp_info->in_stores, listb_inst);
       info_map[a] = temp_info;
 
     } else {
@@ -47,8 +47,6 @@ struct RowLemmaTypeHashFunction {
 void printList (CTNodeList* list);
 void printList( List<TNode>* list);
 
-bool inList(const CTNodeList* l, const TNode el);
-
 /**
  * Small class encapsulating the information
  * in the map. It's a class and not a struct to
@@ -72,6 +70,12 @@ public:
   Info(context::Context* c, Backtracker<TNode>* bck);
   ~Info();
 
+  /**
+   * Adds el to l, which is one of the lists indices, stores or in_stores of
+   * this info, if el is not already in l. Returns true if el was added.
+   */
+  bool addToList(CTNodeList* l, TNode el);
+
   /**
    * prints the information
    */
@@ -84,6 +88,20 @@ public:
     Trace("arrays-info")<<"  in_stores ";
     printList(in_stores);
   }
+
+ private:
+  /** Get the position map for list l, see below */
+  std::unordered_map<Node, size_t>& getPositions(const CTNodeList* l);
+  /**
+   * Maps the elements of indices, stores and in_stores to their position in
+   * the respective list, for constant-time membership tests in addToList.
+   * These maps are not context-dependent: since the lists only shrink on
+   * backtracking, an entry is valid if and only if its position is within
+   * its list and holds its element, which is checked when it is used.
+   */
+  std::unordered_map<Node, size_t> d_indicesPos;
+  std::unordered_map<Node, size_t> d_storesPos;
+  std::unordered_map<Node, size_t> d_inStoresPos;
 };/* class Info */
 
 typedef std::unordered_map<Node, Info*> CNodeInfoMap;
@@ -118,15 +136,10 @@ private:
   SizeStat<CNodeInfoMap> d_tableSize;
 
   /**
-   * checks if a certain element is in the list l
-   * FIXME: better way to check for duplicates?
-   */
-
-  /**
-   * helper method that merges two lists into the first
+   * helper method that merges list lb into list la of info ia
    * without adding duplicates
    */
-  void mergeLists(CTNodeList* la, const CTNodeList* lb) const;
+  void mergeLists(Info* ia, CTNodeList* la, const CTNodeList* lb) const;
 
 public:
   const Info* emptyInfo;
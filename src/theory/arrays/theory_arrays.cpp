@@ -65,6 +65,10 @@ TheoryArrays::TheoryArrays(context::Context* c,
     : Theory(THEORY_ARRAYS, c, u, out, valuation, logicInfo, pnm, name),
       d_numRow(
           smtStatisticsRegistry().registerInt(name + "number of Row lemmas")),
+      d_numRowCandidates(smtStatisticsRegistry().registerInt(
+          name + "number of Row lemma candidates")),
+      d_checkRowTime(
+          smtStatisticsRegistry().registerTimer(name + "time for Row checks")),
       d_numExt(
           smtStatisticsRegistry().registerInt(name + "number of Ext lemmas")),
       d_numProp(
@@ -1651,6 +1655,7 @@ void TheoryArrays::checkStore(TNode a) {
 void TheoryArrays::checkRowForIndex(TNode i, TNode a)
 {
   if (options::arraysWeakEquivalence()) return;
+  TimerStat::CodeTimer codeTimer(d_checkRowTime, true);
   Trace("arrays-cri")<<"Arrays::checkRowForIndex "<<a<<"\n";
   Trace("arrays-cri")<<"                   index "<<i<<"\n";
 
@@ -1711,6 +1716,7 @@ void TheoryArrays::checkRowForIndex(TNode i, TNode a)
 void TheoryArrays::checkRowLemmas(TNode a, TNode b)
 {
   if (options::arraysWeakEquivalence()) return;
+  TimerStat::CodeTimer codeTimer(d_checkRowTime, true);
   Trace("arrays-crl")<<"Arrays::checkLemmas begin \n"<<a<<"\n";
   if(Trace.isOn("arrays-crl"))
     d_infoMap.getInfo(a)->print();
@@ -1831,6 +1837,7 @@ void TheoryArrays::propagateRowLemma(RowLemmaType lem)
 void TheoryArrays::queueRowLemma(RowLemmaType lem)
 {
   Debug("pf::array") << "Array solver: queue row lemma called" << std::endl;
+  ++d_numRowCandidates;
 
   if (d_state.isInConflict() || d_RowAlreadyAdded.contains(lem))
   {
@@ -112,6 +112,10 @@ class TheoryArrays : public Theory {
 
   /** number of Row lemmas */
   IntStat d_numRow;
+  /** number of candidate Row lemmas considered by queueRowLemma */
+  IntStat d_numRowCandidates;
+  /** time spent looking for Row lemmas in checkRowForIndex/checkRowLemmas */
+  TimerStat d_checkRowTime;
   /** number of Ext lemmas */
   IntStat d_numExt;
   /** number of propagations */
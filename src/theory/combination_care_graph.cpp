@@ -16,7 +16,9 @@
 #include "theory/combination_care_graph.h"
 
 #include "expr/node_visitor.h"
+#include "options/theory_options.h"
 #include "prop/prop_engine.h"
+#include "smt/smt_statistics_registry.h"
 #include "theory/care_graph.h"
 #include "theory/model_manager.h"
 #include "theory/shared_solver.h"
@@ -30,7 +32,11 @@ CombinationCareGraph::CombinationCareGraph(
     Env& env,
     const std::vector<Theory*>& paraTheories,
     ProofNodeManager* pnm)
-    : CombinationEngine(te, env, paraTheories, pnm)
+    : CombinationEngine(te, env, paraTheories, pnm),
+      d_numCarePairs(smtStatisticsRegistry().registerInt(
+          "theory::combination::carePairs")),
+      d_numSplits(
+          smtStatisticsRegistry().registerInt("theory::combination::splits"))
 {
 }
 
@@ -52,9 +58,13 @@ void CombinationCareGraph::combineTheories()
   Trace("combineTheories")
       << "TheoryEngine::combineTheories(): care graph size = "
       << careGraph.size() << std::endl;
+  d_numCarePairs += careGraph.size();
 
   // Now add splitters for the ones we are interested in
   prop::PropEngine* propEngine = d_te.getPropEngine();
+  // the equalities we have split on, which may be in the care graph of
+  // several theories
+  std::unordered_set<Node> processed;
   for (const CarePair& carePair : careGraph)
   {
     Debug("combineTheories")
@@ -63,6 +73,10 @@ void CombinationCareGraph::combineTheories()
 
     // The equality in question (order for no repetition)
     Node equality = carePair.d_a.eqNode(carePair.d_b);
+    if (!processed.insert(equality).second)
+    {
+      continue;
+    }
 
     // We need to split on it
     Debug("combineTheories")
@@ -80,18 +94,20 @@ void CombinationCareGraph::combineTheories()
       tsplit = TrustNode::mkTrustLemma(split, nullptr);
     }
     d_sharedSolver->sendLemma(tsplit, carePair.d_theory);
+    ++d_numSplits;
 
-    // Could check the equality status here:
-    //   EqualityStatus es = getEqualityStatus(carePair.d_a, carePair.d_b);
-    // and only require true phase below if:
-    //   es == EQUALITY_TRUE || es == EQUALITY_TRUE_IN_MODEL
-    // and require false phase below if:
-    //   es == EQUALITY_FALSE_IN_MODEL
-    // This is supposed to force preference to follow what the theory models
-    // already have but it doesn't seem to make a big difference - need to
-    // explore more -Clark
+    // By default, we prefer the equality. Otherwise, the preference follows
+    // what the model of the theory of the split terms already has, so that
+    // only equalities that conflict with that model lead to changes.
+    bool phase = true;
+    if (options::tcModelPhase())
+    {
+      EqualityStatus es =
+          d_valuation.getEqualityStatus(carePair.d_a, carePair.d_b);
+      phase = es != EQUALITY_FALSE && es != EQUALITY_FALSE_IN_MODEL;
+    }
     Node e = d_valuation.ensureLiteral(equality);
-    propEngine->requirePhase(e, true);
+    propEngine->requirePhase(e, phase);
   }
 }
 
@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "theory/combination_engine.h"
+#include "util/statistics_stats.h"
 
 namespace cvc5 {
 
@@ -43,9 +44,17 @@ class CombinationCareGraph : public CombinationEngine
 
   bool buildModel() override;
   /**
-   * Combine theories using a care graph.
+   * Combine theories using a care graph. This splits on the equality of each
+   * care pair once per call, even if it is in the care graph of several
+   * theories.
    */
   void combineTheories() override;
+
+ private:
+  /** The number of care pairs computed by the theories */
+  IntStat d_numCarePairs;
+  /** The number of splits on care pairs that were sent */
+  IntStat d_numSplits;
 };
 
 }  // namespace theory
@@ -60,6 +60,8 @@ TheoryDatatypes::TheoryDatatypes(Context* c,
       d_collectTermsCache(c),
       d_collectTermsCacheU(u),
       d_functionTerms(c),
+      d_cycleCands(c),
+      d_cycleCandsChecked(c, 0),
       d_singleton_eq(u),
       d_lemmas_produced_c(u),
       d_sygusExtension(nullptr),
@@ -525,6 +527,7 @@ TrustNode TheoryDatatypes::explain(TNode literal)
 void TheoryDatatypes::eqNotifyNewClass(TNode t){
   if( t.getKind()==APPLY_CONSTRUCTOR ){
     getOrMakeEqcInfo( t, true );
+    d_cycleCands.push_back(t);
   }
 }
 
@@ -534,6 +537,7 @@ void TheoryDatatypes::eqNotifyMerge(TNode t1, TNode t2)
   if( t1.getType().isDatatype() ){
     Trace("datatypes-debug")
         << "NotifyMerge : " << t1 << " " << t2 << std::endl;
+    d_cycleCands.push_back(t1);
     merge(t1,t2);
   }
 }
@@ -1465,45 +1469,62 @@ void TheoryDatatypes::instantiate( EqcInfo* eqc, Node n ){
 
 void TheoryDatatypes::checkCycles() {
   Trace("datatypes-cycle-check") << "Check acyclicity" << std::endl;
-  std::vector< Node > cdt_eqc;
-  eq::EqClassesIterator eqcs_i = eq::EqClassesIterator(d_equalityEngine);
-  while( !eqcs_i.isFinished() ){
-    Node eqc = (*eqcs_i);
-    TypeNode tn = eqc.getType();
-    if( tn.isDatatype() ) {
-      if( !tn.isCodatatype() ){
-        if( options::dtCyclic() ){
-          //do cycle checks
-          std::map< TNode, bool > visited;
-          std::map< TNode, bool > proc;
-          std::vector<Node> expl;
-          Trace("datatypes-cycle-check") << "...search for cycle starting at " << eqc << std::endl;
-          Node cn = searchForCycle( eqc, eqc, visited, proc, expl );
-          Trace("datatypes-cycle-check") << "...finish." << std::endl;
-          //if we discovered a different cycle while searching this one
-          if( !cn.isNull() && cn!=eqc ){
-            visited.clear();
-            proc.clear();
-            expl.clear();
-            Node prev = cn;
-            cn = searchForCycle( cn, cn, visited, proc, expl );
-            Assert(prev == cn);
-          }
+  if (options::dtCyclic())
+  {
+    // The graph was acyclic at the last complete check, hence any cycle goes
+    // through the equivalence class of a term added to d_cycleCands since
+    // then. The nodes that are processed by a search do not reach a cycle,
+    // hence they are shared between the searches.
+    std::map<TNode, bool> proc;
+    size_t ncands = d_cycleCands.size();
+    for (size_t i = d_cycleCandsChecked.get(); i < ncands; i++)
+    {
+      Node eqc = getRepresentative(d_cycleCands[i]);
+      TypeNode tn = eqc.getType();
+      if (!tn.isDatatype() || tn.isCodatatype())
+      {
+        continue;
+      }
+      //do cycle checks
+      std::map< TNode, bool > visited;
+      std::vector<Node> expl;
+      Trace("datatypes-cycle-check") << "...search for cycle starting at " << eqc << std::endl;
+      Node cn = searchForCycle( eqc, eqc, visited, proc, expl );
+      Trace("datatypes-cycle-check") << "...finish." << std::endl;
+      //if we discovered a different cycle while searching this one
+      if( !cn.isNull() && cn!=eqc ){
+        visited.clear();
+        std::map<TNode, bool> cproc;
+        expl.clear();
+        Node prev = cn;
+        cn = searchForCycle( cn, cn, visited, cproc, expl );
+        Assert(prev == cn);
+      }
 
-          if( !cn.isNull() ) {
-            Assert(expl.size() > 0);
-            Trace("dt-conflict")
-                << "CONFLICT: Cycle conflict : " << expl << std::endl;
-            d_im.sendDtConflict(expl, InferenceId::DATATYPES_CYCLE);
-            return;
-          }
-        }
-      }else{
+      if( !cn.isNull() ) {
+        Assert(expl.size() > 0);
+        Trace("dt-conflict")
+            << "CONFLICT: Cycle conflict : " << expl << std::endl;
+        d_im.sendDtConflict(expl, InferenceId::DATATYPES_CYCLE);
+        return;
+      }
+    }
+    d_cycleCandsChecked = ncands;
+  }
+  std::vector< Node > cdt_eqc;
+  if (options::cdtBisimilar())
+  {
+    eq::EqClassesIterator eqcs_i = eq::EqClassesIterator(d_equalityEngine);
+    while (!eqcs_i.isFinished())
+    {
+      Node eqc = (*eqcs_i);
+      if (eqc.getType().isCodatatype())
+      {
         //indexing
         cdt_eqc.push_back( eqc );
       }
+      ++eqcs_i;
     }
-    ++eqcs_i;
   }
   Trace("datatypes-cycle-check") << "Check uniqueness" << std::endl;
   //process codatatypes
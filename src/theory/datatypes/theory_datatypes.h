@@ -149,6 +149,19 @@ private:
   BoolMap d_collectTermsCacheU;
   /** All the function terms that the theory has seen */
   context::CDList<TNode> d_functionTerms;
+  /**
+   * The terms whose equivalence classes were merged or created with a
+   * constructor, in the order of notification. Any cycle in the graph of
+   * equivalence classes of (non-co)datatypes must go through the
+   * equivalence class of one of these terms that was added since the last
+   * complete check of acyclicity.
+   */
+  NodeList d_cycleCands;
+  /**
+   * The number of terms in d_cycleCands whose equivalence classes were
+   * checked for cycles.
+   */
+  context::CDO<size_t> d_cycleCandsChecked;
   /** counter for forcing assignments (ensures fairness) */
   unsigned d_dtfCounter;
   /** uninterpreted constant to variable map */
@@ -249,8 +262,17 @@ private:
   void merge( Node t1, Node t2 );
   /** collapse selector, s is of the form sel( n ) where n = c */
   void collapseSelector( Node s, Node c );
-  /** for checking if cycles exist */
+  /**
+   * For checking if cycles exist. This only searches from the equivalence
+   * classes in d_cycleCands that were not checked yet, since the graph was
+   * acyclic at the last complete check.
+   */
   void checkCycles();
+  /**
+   * Search for a cycle reachable from n, where on is the start of the
+   * search. The nodes in proc are known to not reach a cycle, which can be
+   * shared between searches as long as no cycle is found.
+   */
   Node searchForCycle(TNode n,
                       TNode on,
                       std::map<TNode, bool>& visited,
@@ -35,6 +35,8 @@ const char* toString(IncompleteId i)
       return "QUANTIFIERS_RECORDED_INST";
     case IncompleteId::QUANTIFIERS_MAX_INST_ROUNDS:
       return "QUANTIFIERS_MAX_INST_ROUNDS";
+    case IncompleteId::QUANTIFIERS_INST_DEFERRED:
+      return "QUANTIFIERS_INST_DEFERRED";
     case IncompleteId::SEP: return "SEP";
     case IncompleteId::SETS_RELS_CARD: return "SETS_RELS_CARD";
     case IncompleteId::STRINGS_LOOP_SKIP: return "STRINGS_LOOP_SKIP";
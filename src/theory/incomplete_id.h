@@ -44,6 +44,8 @@ enum class IncompleteId
   QUANTIFIERS_RECORDED_INST,
   // incomplete due to limited number of allowed instantiation rounds
   QUANTIFIERS_MAX_INST_ROUNDS,
+  // incomplete due to instantiations deferred by a per-round limit
+  QUANTIFIERS_INST_DEFERRED,
   // incomplete due to separation logic
   SEP,
   // relations were used in combination with set cardinality constraints
@@ -725,6 +725,9 @@ enum class InferenceId
   //  (or (= t1 t2) (not (= t1 t2))
   // to satisfy the cardinality constraints on the type of t1, t2.
   UF_CARD_SPLIT,
+  // totality axiom (card_T n) => (or (= t r1) ... (= t rk)) where r1, ..., rn
+  // are fresh constants of T, and k <= n is the symmetry breaking index of t.
+  UF_CARD_TOTALITY,
   //-------------------- end cardinality extension to UF
   //-------------------- HO extension to UF
   // Encodes an n-ary application as a chain of binary HO_APPLY applications
@@ -75,6 +75,7 @@ bool Instantiate::reset(Theory::Effort e)
   // clear explicitly recorded instantiations
   d_recordedInst.clear();
   d_instDebugTemp.clear();
+  d_instDeferTemp.clear();
   return true;
 }
 
@@ -88,6 +89,13 @@ bool Instantiate::checkComplete(IncompleteId& incId)
     incId = IncompleteId::QUANTIFIERS_RECORDED_INST;
     return false;
   }
+  if (!d_instDeferTemp.empty())
+  {
+    Trace("quant-engine-debug")
+        << "Set incomplete due to deferred instantiations." << std::endl;
+    incId = IncompleteId::QUANTIFIERS_INST_DEFERRED;
+    return false;
+  }
   return true;
 }
 
@@ -226,6 +234,23 @@ bool Instantiate::addInstantiation(Node q,
     }
   }
 
+  // check whether we have reached the per-round limit for q, in which case
+  // we defer the instantiation, that is, we do not record it
+  if (isInstLimitReached(q))
+  {
+    if (existsInstantiation(q, terms, modEq))
+    {
+      Trace("inst-add-debug") << " --> Already exists." << std::endl;
+      ++(d_statistics.d_inst_duplicate_eq);
+      return false;
+    }
+    Trace("inst-add-debug") << " --> Deferred (limit reached)." << std::endl;
+    d_instDeferTemp[q]++;
+    d_instDeferTotal[q]++;
+    ++(d_statistics.d_inst_deferred);
+    return false;
+  }
+
   // record the instantiation
   bool recorded = recordInstantiationInternal(q, terms, modEq);
   if (!recorded)
@@ -592,6 +617,18 @@ bool Instantiate::recordInstantiationInternal(Node q,
   return d_inst_match_trie[q].addInstMatch(d_qstate, q, terms, modEq);
 }
 
+bool Instantiate::isInstLimitReached(Node q) const
+{
+  int64_t limit = options::instMaxPerQuantRound();
+  if (limit < 0)
+  {
+    return false;
+  }
+  std::map<Node, uint32_t>::const_iterator it = d_instDebugTemp.find(q);
+  uint64_t num = it == d_instDebugTemp.end() ? 0 : it->second;
+  return num >= static_cast<uint64_t>(limit);
+}
+
 bool Instantiate::removeInstantiationInternal(Node q, std::vector<Node>& terms)
 {
   if (options::incrementalSolving())
@@ -685,6 +722,11 @@ void Instantiate::notifyEndRound()
       Trace("inst-per-quant-round")
           << " * " << i.second << " for " << i.first << std::endl;
     }
+    for (std::pair<const Node, uint32_t>& i : d_instDeferTemp)
+    {
+      Trace("inst-per-quant-round")
+          << " * " << i.second << " deferred for " << i.first << std::endl;
+    }
   }
   if (Output.isOn(options::OutputTag::INST))
   {
@@ -699,6 +741,17 @@ void Instantiate::notifyEndRound()
       Output(options::OutputTag::INST) << "(num-instantiations " << name << " "
                                        << i.second << ")" << std::endl;
     }
+    for (std::pair<const Node, uint32_t>& i : d_instDeferTemp)
+    {
+      Node name;
+      if (!d_qreg.getNameForQuant(i.first, name, req))
+      {
+        continue;
+      }
+      Output(options::OutputTag::INST)
+          << "(num-instantiations-deferred " << name << " " << i.second << ")"
+          << std::endl;
+    }
   }
 }
 
@@ -712,6 +765,11 @@ void Instantiate::debugPrintModel()
       Trace("inst-per-quant") << " * " << (*it).second->d_list.size() << " for "
                               << (*it).first << std::endl;
     }
+    for (std::pair<const Node, uint32_t>& i : d_instDeferTotal)
+    {
+      Trace("inst-per-quant")
+          << " * " << i.second << " deferred for " << i.first << std::endl;
+    }
   }
 }
 
@@ -752,7 +810,9 @@ Instantiate::Statistics::Statistics()
       d_inst_duplicate_eq(smtStatisticsRegistry().registerInt(
           "Instantiate::Duplicate_Inst_Eq")),
       d_inst_duplicate_ent(smtStatisticsRegistry().registerInt(
-          "Instantiate::Duplicate_Inst_Entailed"))
+          "Instantiate::Duplicate_Inst_Entailed")),
+      d_inst_deferred(
+          smtStatisticsRegistry().registerInt("Instantiate::Deferred_Inst"))
 {
 }
 
@@ -155,7 +155,11 @@ class Instantiate : public QuantifiersUtil
    *     fast entailment check (see TermDb::isEntailed),
    * (4) The range of the substitution is a duplicate of that of a previously
    *     added instantiation,
-   * (5) The instantiation lemma is a duplicate of previously added lemma.
+   * (5) The instantiation lemma is a duplicate of previously added lemma,
+   * (6) The number of instantiations of q in the current round has reached
+   *     the limit given by option instMaxPerQuantRound, in which case the
+   *     instantiation is deferred, that is, it is not recorded and may be
+   *     added in a later round.
    *
    */
   bool addInstantiation(Node q,
@@ -237,8 +241,9 @@ class Instantiate : public QuantifiersUtil
 
   /**
    * Called once at the end of each instantiation round. This prints
-   * instantiations added this round to trace inst-per-quant-round, if
-   * applicable, and prints to out if the option debug-inst is enabled.
+   * instantiations added (and deferred) this round to trace
+   * inst-per-quant-round, if applicable, and prints to out if the option
+   * debug-inst is enabled.
    */
   void notifyEndRound();
   /** debug print model, called once, before we terminate with sat/unknown. */
@@ -288,6 +293,8 @@ class Instantiate : public QuantifiersUtil
     IntStat d_inst_duplicate;
     IntStat d_inst_duplicate_eq;
     IntStat d_inst_duplicate_ent;
+    /** Number of instantiations deferred due to instMaxPerQuantRound */
+    IntStat d_inst_deferred;
     Statistics();
   }; /* class Instantiate::Statistics */
   Statistics d_statistics;
@@ -301,6 +308,11 @@ class Instantiate : public QuantifiersUtil
   bool recordInstantiationInternal(Node q,
                                    std::vector<Node>& terms,
                                    bool modEq = false);
+  /**
+   * Return true if we have reached the limit on the number of instantiations
+   * for q in the current round, as given by option instMaxPerQuantRound.
+   */
+  bool isInstLimitReached(Node q) const;
   /** remove instantiation from the cache */
   bool removeInstantiationInternal(Node q, std::vector<Node>& terms);
   /**
@@ -339,6 +351,16 @@ class Instantiate : public QuantifiersUtil
   std::map<Node, std::vector<Node> > d_recordedInst;
   /** statistics for debugging total instantiations per quantifier per round */
   std::map<Node, uint32_t> d_instDebugTemp;
+  /**
+   * The number of instantiations per quantifier deferred in the current round
+   * due to the option instMaxPerQuantRound.
+   */
+  std::map<Node, uint32_t> d_instDeferTemp;
+  /**
+   * The total number of instantiations per quantifier deferred due to the
+   * option instMaxPerQuantRound, used for debugging.
+   */
+  std::map<Node, uint32_t> d_instDeferTotal;
 
   /** list of all instantiations produced for each quantifier
    *
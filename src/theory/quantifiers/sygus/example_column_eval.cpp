@@ -0,0 +1,508 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2021 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Columnar evaluation of terms on a fixed list of examples.
+ */
+
+#include "theory/quantifiers/sygus/example_column_eval.h"
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <unordered_set>
+
+#include "expr/node_manager.h"
+#include "util/bitvector.h"
+#include "util/rational.h"
+
+using namespace cvc5::kind;
+
+namespace cvc5 {
+namespace theory {
+namespace quantifiers {
+
+namespace {
+
+constexpr int64_t s_min = std::numeric_limits<int64_t>::min();
+
+/** The mask of the lower w bits */
+uint64_t bvMask(uint32_t w)
+{
+  return w >= 64 ? std::numeric_limits<uint64_t>::max()
+                 : (static_cast<uint64_t>(1) << w) - 1;
+}
+
+/** Interpret the bit pattern v of width w as a signed integer */
+int64_t bvSigned(uint64_t v, uint32_t w)
+{
+  if (w >= 64)
+  {
+    return static_cast<int64_t>(v);
+  }
+  uint64_t sign = static_cast<uint64_t>(1) << (w - 1);
+  return static_cast<int64_t>(v ^ sign) - static_cast<int64_t>(sign);
+}
+
+}  // namespace
+
+ExampleColumnEval::ExampleColumnEval(
+    const std::vector<Node>& vars,
+    const std::vector<std::vector<Node>>& examples,
+    size_t numThreads)
+    : d_numExamples(examples.size()), d_numThreads(numThreads)
+{
+  d_varColumns.resize(vars.size());
+  for (size_t i = 0, nvars = vars.size(); i < nvars; i++)
+  {
+    d_varIndex[vars[i]] = i;
+    if (!isSupportedType(vars[i].getType()))
+    {
+      continue;
+    }
+    std::vector<int64_t>& col = d_varColumns[i];
+    for (const std::vector<Node>& ex : examples)
+    {
+      Assert(ex.size() == vars.size());
+      int64_t v;
+      if (!getValue(ex[i], v))
+      {
+        col.clear();
+        break;
+      }
+      col.push_back(v);
+    }
+  }
+}
+
+bool ExampleColumnEval::isSupportedType(TypeNode tn)
+{
+  return tn.isBoolean() || tn.isReal()
+         || (tn.isBitVector() && tn.getBitVectorSize() <= 64);
+}
+
+bool ExampleColumnEval::getValue(TNode n, int64_t& v)
+{
+  switch (n.getKind())
+  {
+    case CONST_BOOLEAN: v = n.getConst<bool>() ? 1 : 0; return true;
+    case CONST_RATIONAL:
+    {
+      const Rational& r = n.getConst<Rational>();
+      if (!r.isIntegral() || !r.getNumerator().fitsSignedLong())
+      {
+        return false;
+      }
+      v = r.getNumerator().getLong();
+      return true;
+    }
+    case CONST_BITVECTOR:
+    {
+      const BitVector& bv = n.getConst<BitVector>();
+      if (bv.getSize() > 64)
+      {
+        return false;
+      }
+      v = static_cast<int64_t>(bv.getValue().getUnsignedLong());
+      return true;
+    }
+    default: break;
+  }
+  return false;
+}
+
+Node ExampleColumnEval::mkValue(TypeNode tn, int64_t v)
+{
+  NodeManager* nm = NodeManager::currentNM();
+  if (tn.isBoolean())
+  {
+    return nm->mkConst(v != 0);
+  }
+  if (tn.isBitVector())
+  {
+    return nm->mkConst(BitVector(tn.getBitVectorSize(),
+                                 Integer(static_cast<uint64_t>(v))));
+  }
+  Assert(tn.isReal());
+  return nm->mkConst(Rational(Integer(v)));
+}
+
+bool ExampleColumnEval::compile(TNode n, std::vector<Instr>& prog)
+{
+  // maps compiled subterms to their register
+  std::unordered_map<TNode, size_t> reg;
+  // the subterms whose children have been visited
+  std::unordered_set<TNode> visited;
+  std::vector<TNode> visit;
+  visit.push_back(n);
+  while (!visit.empty())
+  {
+    TNode cur = visit.back();
+    if (reg.find(cur) != reg.end())
+    {
+      visit.pop_back();
+      continue;
+    }
+    if (!isSupportedType(cur.getType()))
+    {
+      return false;
+    }
+    Instr i;
+    i.d_kind = cur.getKind();
+    i.d_width = 0;
+    i.d_const = 0;
+    if (cur.isConst())
+    {
+      if (!getValue(cur, i.d_const))
+      {
+        return false;
+      }
+    }
+    else if (cur.isVar())
+    {
+      std::unordered_map<Node, size_t>::iterator itv = d_varIndex.find(cur);
+      if (itv == d_varIndex.end()
+          || d_varColumns[itv->second].size() != d_numExamples)
+      {
+        return false;
+      }
+      i.d_const = static_cast<int64_t>(itv->second);
+    }
+    else if (visited.find(cur) == visited.end())
+    {
+      switch (cur.getKind())
+      {
+        case NOT:
+        case AND:
+        case OR:
+        case XOR:
+        case IMPLIES:
+        case EQUAL:
+        case ITE:
+        case PLUS:
+        case MULT:
+        case NONLINEAR_MULT:
+        case MINUS:
+        case UMINUS:
+        case ABS:
+        case LT:
+        case LEQ:
+        case GT:
+        case GEQ:
+        case BITVECTOR_ADD:
+        case BITVECTOR_SUB:
+        case BITVECTOR_MULT:
+        case BITVECTOR_NEG:
+        case BITVECTOR_NOT:
+        case BITVECTOR_AND:
+        case BITVECTOR_OR:
+        case BITVECTOR_XOR:
+        case BITVECTOR_SHL:
+        case BITVECTOR_LSHR:
+        case BITVECTOR_UDIV:
+        case BITVECTOR_UREM:
+        case BITVECTOR_COMP:
+        case BITVECTOR_ULT:
+        case BITVECTOR_ULE:
+        case BITVECTOR_UGT:
+        case BITVECTOR_UGE:
+        case BITVECTOR_SLT:
+        case BITVECTOR_SLE:
+        case BITVECTOR_SGT:
+        case BITVECTOR_SGE: break;
+        default: return false;
+      }
+      visited.insert(cur);
+      visit.insert(visit.end(), cur.begin(), cur.end());
+      continue;
+    }
+    else
+    {
+      // all children are compiled
+      for (TNode cn : cur)
+      {
+        i.d_args.push_back(reg.at(cn));
+      }
+      TypeNode wtn = cur[0].getType();
+      if (wtn.isBitVector())
+      {
+        i.d_width = wtn.getBitVectorSize();
+      }
+    }
+    visit.pop_back();
+    reg[cur] = prog.size();
+    prog.push_back(i);
+  }
+  return true;
+}
+
+bool ExampleColumnEval::evaluate(TNode n, std::vector<int64_t>& res)
+{
+  std::vector<Instr> prog;
+  if (!compile(n, prog))
+  {
+    return false;
+  }
+  d_regs.resize(prog.size() * d_numExamples);
+  // split the examples into slices of at least s_minSliceSize examples
+  size_t nslices = std::min<size_t>(d_numThreads,
+                                    d_numExamples / s_minSliceSize);
+  if (nslices <= 1)
+  {
+    if (!execute(prog, 0, d_numExamples))
+    {
+      return false;
+    }
+  }
+  else
+  {
+    // Each worker runs the entire program on its own slice of the examples.
+    // Workers only read prog and d_varColumns, and write disjoint parts of
+    // d_regs, hence the result is independent of scheduling.
+    size_t sliceSize = (d_numExamples + nslices - 1) / nslices;
+    std::vector<char> sliceOk(nslices, 0);
+    std::vector<std::thread> workers;
+    for (size_t s = 1; s < nslices; s++)
+    {
+      size_t begin = s * sliceSize;
+      size_t end = std::min(begin + sliceSize, d_numExamples);
+      workers.emplace_back([this, &prog, &sliceOk, s, begin, end]() {
+        sliceOk[s] = execute(prog, begin, end);
+      });
+    }
+    sliceOk[0] = execute(prog, 0, sliceSize);
+    for (std::thread& w : workers)
+    {
+      w.join();
+    }
+    if (std::find(sliceOk.begin(), sliceOk.end(), 0) != sliceOk.end())
+    {
+      return false;
+    }
+  }
+  const int64_t* col = column(prog.size() - 1);
+  res.assign(col, col + d_numExamples);
+  return true;
+}
+
+bool ExampleColumnEval::execute(const std::vector<Instr>& prog,
+                                size_t begin,
+                                size_t end)
+{
+  for (size_t r = 0, nprog = prog.size(); r < nprog; r++)
+  {
+    if (!execute(prog[r], r, begin, end))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ExampleColumnEval::execute(const Instr& i,
+                                size_t out,
+                                size_t begin,
+                                size_t end)
+{
+  int64_t* o = column(out);
+  if (i.d_kind == CONST_BOOLEAN || i.d_kind == CONST_RATIONAL
+      || i.d_kind == CONST_BITVECTOR)
+  {
+    std::fill(o + begin, o + end, i.d_const);
+    return true;
+  }
+  if (i.d_args.empty())
+  {
+    // a variable
+    const int64_t* vc = d_varColumns[i.d_const].data();
+    std::copy(vc + begin, vc + end, o + begin);
+    return true;
+  }
+  const int64_t* a = column(i.d_args[0]);
+  const int64_t* b = i.d_args.size() > 1 ? column(i.d_args[1]) : nullptr;
+  const uint64_t mask = bvMask(i.d_width);
+  const uint32_t w = i.d_width;
+  bool ok = true;
+  switch (i.d_kind)
+  {
+    case NOT:
+      for (size_t j = begin; j < end; j++) o[j] = a[j] ^ 1;
+      break;
+    case IMPLIES:
+      for (size_t j = begin; j < end; j++) o[j] = (a[j] ^ 1) | b[j];
+      break;
+    case EQUAL:
+      for (size_t j = begin; j < end; j++) o[j] = a[j] == b[j];
+      break;
+    case ITE:
+    {
+      const int64_t* c = column(i.d_args[2]);
+      for (size_t j = begin; j < end; j++) o[j] = a[j] ? b[j] : c[j];
+      break;
+    }
+    case MINUS:
+      for (size_t j = begin; j < end; j++)
+        ok &= !__builtin_sub_overflow(a[j], b[j], &o[j]);
+      break;
+    case UMINUS:
+      for (size_t j = begin; j < end; j++)
+      {
+        ok &= a[j] != s_min;
+        o[j] = a[j] == s_min ? 0 : -a[j];
+      }
+      break;
+    case ABS:
+      for (size_t j = begin; j < end; j++)
+      {
+        ok &= a[j] != s_min;
+        o[j] = a[j] == s_min ? 0 : (a[j] < 0 ? -a[j] : a[j]);
+      }
+      break;
+    case LT:
+      for (size_t j = begin; j < end; j++) o[j] = a[j] < b[j];
+      break;
+    case LEQ:
+      for (size_t j = begin; j < end; j++) o[j] = a[j] <= b[j];
+      break;
+    case GT:
+      for (size_t j = begin; j < end; j++) o[j] = a[j] > b[j];
+      break;
+    case GEQ:
+      for (size_t j = begin; j < end; j++) o[j] = a[j] >= b[j];
+      break;
+    case BITVECTOR_SUB:
+      for (size_t j = begin; j < end; j++)
+        o[j] = static_cast<int64_t>(
+            (static_cast<uint64_t>(a[j]) - static_cast<uint64_t>(b[j])) & mask);
+      break;
+    case BITVECTOR_NEG:
+      for (size_t j = begin; j < end; j++)
+        o[j] = static_cast<int64_t>((-static_cast<uint64_t>(a[j])) & mask);
+      break;
+    case BITVECTOR_NOT:
+      for (size_t j = begin; j < end; j++)
+        o[j] = static_cast<int64_t>((~static_cast<uint64_t>(a[j])) & mask);
+      break;
+    case BITVECTOR_SHL:
+      for (size_t j = begin; j < end; j++)
+      {
+        uint64_t s = static_cast<uint64_t>(b[j]);
+        o[j] = s >= w ? 0
+                      : static_cast<int64_t>(
+                          (static_cast<uint64_t>(a[j]) << s) & mask);
+      }
+      break;
+    case BITVECTOR_LSHR:
+      for (size_t j = begin; j < end; j++)
+      {
+        uint64_t s = static_cast<uint64_t>(b[j]);
+        o[j] = s >= w ? 0
+                      : static_cast<int64_t>(static_cast<uint64_t>(a[j]) >> s);
+      }
+      break;
+    case BITVECTOR_UDIV:
+      for (size_t j = begin; j < end; j++)
+        o[j] = b[j] == 0 ? static_cast<int64_t>(mask)
+                         : static_cast<int64_t>(static_cast<uint64_t>(a[j])
+                                                / static_cast<uint64_t>(b[j]));
+      break;
+    case BITVECTOR_UREM:
+      for (size_t j = begin; j < end; j++)
+        o[j] = b[j] == 0 ? a[j]
+                         : static_cast<int64_t>(static_cast<uint64_t>(a[j])
+                                                % static_cast<uint64_t>(b[j]));
+      break;
+    case BITVECTOR_COMP:
+      for (size_t j = begin; j < end; j++) o[j] = a[j] == b[j];
+      break;
+    case BITVECTOR_ULT:
+      for (size_t j = begin; j < end; j++)
+        o[j] = static_cast<uint64_t>(a[j]) < static_cast<uint64_t>(b[j]);
+      break;
+    case BITVECTOR_ULE:
+      for (size_t j = begin; j < end; j++)
+        o[j] = static_cast<uint64_t>(a[j]) <= static_cast<uint64_t>(b[j]);
+      break;
+    case BITVECTOR_UGT:
+      for (size_t j = begin; j < end; j++)
+        o[j] = static_cast<uint64_t>(a[j]) > static_cast<uint64_t>(b[j]);
+      break;
+    case BITVECTOR_UGE:
+      for (size_t j = begin; j < end; j++)
+        o[j] = static_cast<uint64_t>(a[j]) >= static_cast<uint64_t>(b[j]);
+      break;
+    case BITVECTOR_SLT:
+      for (size_t j = begin; j < end; j++)
+        o[j] = bvSigned(a[j], w) < bvSigned(b[j], w);
+      break;
+    case BITVECTOR_SLE:
+      for (size_t j = begin; j < end; j++)
+        o[j] = bvSigned(a[j], w) <= bvSigned(b[j], w);
+      break;
+    case BITVECTOR_SGT:
+      for (size_t j = begin; j < end; j++)
+        o[j] = bvSigned(a[j], w) > bvSigned(b[j], w);
+      break;
+    case BITVECTOR_SGE:
+      for (size_t j = begin; j < end; j++)
+        o[j] = bvSigned(a[j], w) >= bvSigned(b[j], w);
+      break;
+    default:
+    {
+      // n-ary operators, folded over the arguments
+      std::copy(a + begin, a + end, o + begin);
+      for (size_t k = 1, nargs = i.d_args.size(); k < nargs; k++)
+      {
+        const int64_t* c = column(i.d_args[k]);
+        switch (i.d_kind)
+        {
+          case AND:
+          case BITVECTOR_AND:
+            for (size_t j = begin; j < end; j++) o[j] &= c[j];
+            break;
+          case OR:
+          case BITVECTOR_OR:
+            for (size_t j = begin; j < end; j++) o[j] |= c[j];
+            break;
+          case XOR:
+          case BITVECTOR_XOR:
+            for (size_t j = begin; j < end; j++) o[j] ^= c[j];
+            break;
+          case PLUS:
+            for (size_t j = begin; j < end; j++)
+              ok &= !__builtin_add_overflow(o[j], c[j], &o[j]);
+            break;
+          case MULT:
+          case NONLINEAR_MULT:
+            for (size_t j = begin; j < end; j++)
+              ok &= !__builtin_mul_overflow(o[j], c[j], &o[j]);
+            break;
+          case BITVECTOR_ADD:
+            for (size_t j = begin; j < end; j++)
+              o[j] = static_cast<int64_t>(
+                  (static_cast<uint64_t>(o[j]) + static_cast<uint64_t>(c[j]))
+                  & mask);
+            break;
+          case BITVECTOR_MULT:
+            for (size_t j = begin; j < end; j++)
+              o[j] = static_cast<int64_t>(
+                  (static_cast<uint64_t>(o[j]) * static_cast<uint64_t>(c[j]))
+                  & mask);
+            break;
+          default: Unreachable() << "Unexpected kind " << i.d_kind; break;
+        }
+      }
+      break;
+    }
+  }
+  return ok;
+}
+
+}  // namespace quantifiers
+}  // namespace theory
+}  // namespace cvc5
@@ -0,0 +1,126 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2021 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Columnar evaluation of terms on a fixed list of examples.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__THEORY__QUANTIFIERS__EXAMPLE_COLUMN_EVAL_H
+#define CVC5__THEORY__QUANTIFIERS__EXAMPLE_COLUMN_EVAL_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "expr/node.h"
+
+namespace cvc5 {
+namespace theory {
+namespace quantifiers {
+
+/**
+ * Evaluates terms on a fixed list of examples without constructing
+ * intermediate nodes.
+ *
+ * The values of all examples are stored as flat columns of 64-bit machine
+ * integers, one column per variable. Booleans are stored as 0 and 1, integers
+ * by their value and bit-vectors of width at most 64 by their (unsigned) bit
+ * pattern. A term is first compiled into a straight-line program whose
+ * instructions correspond to the distinct subterms of the term. Each
+ * instruction is then executed for all examples at once, reading the columns
+ * of its arguments and writing the column of its result.
+ *
+ * Only a fragment of the Boolean, integer and bit-vector operators is
+ * supported. Evaluation fails if the term contains any other operator, a
+ * variable or constant whose values cannot be represented as above, or if an
+ * integer operation overflows. Callers are expected to fall back to node-based
+ * evaluation (e.g. ExampleMinEval) in these cases.
+ *
+ * Since the columns of the examples are independent, the examples may be
+ * split into slices that are evaluated by separate threads. Compilation and
+ * the conversion of values to nodes happen on the calling thread only, as
+ * the node manager is not thread-safe.
+ */
+class ExampleColumnEval
+{
+ public:
+  /**
+   * @param vars The variables of the terms to evaluate
+   * @param examples The examples, where examples[j][i] is the value of vars[i]
+   * in the j^th example
+   * @param numThreads The maximal number of threads used by evaluate
+   */
+  ExampleColumnEval(const std::vector<Node>& vars,
+                    const std::vector<std::vector<Node>>& examples,
+                    size_t numThreads = 1);
+  /**
+   * Evaluate n on all examples. Returns true and stores the value of n on
+   * the j^th example in res[j] if successful.
+   */
+  bool evaluate(TNode n, std::vector<int64_t>& res);
+  /** Convert a value computed by evaluate to a constant of type tn */
+  static Node mkValue(TypeNode tn, int64_t v);
+
+ private:
+  /** An instruction writing the column of a single subterm */
+  struct Instr
+  {
+    /** The kind of the subterm */
+    Kind d_kind;
+    /** The bit-width, if the arguments are bit-vectors */
+    uint32_t d_width;
+    /** The registers of the arguments */
+    std::vector<size_t> d_args;
+    /** The value, if this is a constant */
+    int64_t d_const;
+  };
+  /**
+   * Convert constant n to its representation, returns false if it has none.
+   */
+  static bool getValue(TNode n, int64_t& v);
+  /** Whether values of type tn can be represented */
+  static bool isSupportedType(TypeNode tn);
+  /**
+   * Compile n to a sequence of instructions. Returns false if n contains an
+   * unsupported operator.
+   */
+  bool compile(TNode n, std::vector<Instr>& prog);
+  /**
+   * Execute prog on the examples with index in [begin, end). Returns false on
+   * overflow.
+   */
+  bool execute(const std::vector<Instr>& prog, size_t begin, size_t end);
+  /**
+   * Execute instruction i on the examples with index in [begin, end), writing
+   * register out. Returns false on overflow.
+   */
+  bool execute(const Instr& i, size_t out, size_t begin, size_t end);
+  /** Get the column of register r */
+  int64_t* column(size_t r) { return d_regs.data() + r * d_numExamples; }
+
+  /** The number of examples */
+  size_t d_numExamples;
+  /** The maximal number of threads */
+  size_t d_numThreads;
+  /** The minimal number of examples evaluated by a single thread */
+  static constexpr size_t s_minSliceSize = 1024;
+  /** Maps variables to their index */
+  std::unordered_map<Node, size_t> d_varIndex;
+  /** The column of each variable, empty if its values are not representable */
+  std::vector<std::vector<int64_t>> d_varColumns;
+  /** The registers, stored as consecutive columns */
+  std::vector<int64_t> d_regs;
+};
+
+}  // namespace quantifiers
+}  // namespace theory
+}  // namespace cvc5
+
+#endif
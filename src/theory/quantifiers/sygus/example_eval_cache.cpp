@@ -14,8 +14,10 @@
  */
 #include "theory/quantifiers/sygus/example_eval_cache.h"
 
+#include "options/quantifiers_options.h"
 #include "theory/quantifiers/sygus/example_min_eval.h"
 #include "theory/quantifiers/sygus/synth_conjecture.h"
+#include "util/hash.h"
 
 using namespace cvc5;
 using namespace cvc5::kind;
@@ -51,10 +53,39 @@ Node ExampleEvalCache::addSearchVal(TypeNode tn, Node bv)
     return Node::null();
   }
   std::vector<Node> vals;
-  evaluateVec(bv, vals, true);
+  std::vector<int64_t> flat;
+  bool isFlat =
+      d_exOutCache.find(bv) == d_exOutCache.end() && evaluateFlat(bv, flat);
+  if (isFlat)
+  {
+    std::unordered_map<std::vector<int64_t>, Node, FlatHashFunction>& fi =
+        d_flatIndex[tn];
+    auto it = fi.find(flat);
+    if (it != fi.end())
+    {
+      // redundant, the evaluation of bv was not cached
+      Trace("sygus-pbe-debug") << "...got " << it->second << " (flat)"
+                               << std::endl;
+      return it->second;
+    }
+    TypeNode btn = bv.getType();
+    for (int64_t v : flat)
+    {
+      vals.push_back(ExampleColumnEval::mkValue(btn, v));
+    }
+    d_exOutCache[bv] = vals;
+  }
+  else
+  {
+    evaluateVec(bv, vals, true);
+  }
   Trace("sygus-pbe-debug") << "Add to trie..." << std::endl;
   Node ret = d_trie[tn].addOrGetTerm(bv, vals);
   Trace("sygus-pbe-debug") << "...got " << ret << std::endl;
+  if (isFlat)
+  {
+    d_flatIndex[tn][flat] = ret;
+  }
   // Only save the cache data if necessary: if the enumerated term
   // is redundant, its cached data will not be used later and thus should
   // be discarded. This applies also to the case where the evaluation
@@ -88,10 +119,19 @@ void ExampleEvalCache::evaluateVec(Node bv,
   }
 }
 
-void ExampleEvalCache::evaluateVecInternal(Node bv,
-                                           std::vector<Node>& exOut) const
+void ExampleEvalCache::evaluateVecInternal(Node bv, std::vector<Node>& exOut)
 {
-  // use ExampleMinEval
+  std::vector<int64_t> flat;
+  if (evaluateFlat(bv, flat))
+  {
+    TypeNode btn = bv.getType();
+    for (int64_t v : flat)
+    {
+      exOut.push_back(ExampleColumnEval::mkValue(btn, v));
+    }
+    return;
+  }
+  // otherwise, use ExampleMinEval
   SygusTypeInfo& ti = d_tds->getTypeInfo(d_stn);
   const std::vector<Node>& varlist = ti.getVarList();
   EmeEvalTds emetds(d_tds, d_stn);
@@ -103,6 +143,32 @@ void ExampleEvalCache::evaluateVecInternal(Node bv,
   }
 }
 
+bool ExampleEvalCache::evaluateFlat(Node bv, std::vector<int64_t>& res)
+{
+  if (!options::sygusEvalColumns())
+  {
+    return false;
+  }
+  if (d_colEval == nullptr)
+  {
+    const std::vector<Node>& varlist = d_tds->getTypeInfo(d_stn).getVarList();
+    d_colEval.reset(new ExampleColumnEval(
+        varlist, d_examples, options::sygusEvalThreads()));
+  }
+  return d_colEval->evaluate(bv, res);
+}
+
+size_t ExampleEvalCache::FlatHashFunction::operator()(
+    const std::vector<int64_t>& vals) const
+{
+  uint64_t hash = fnv1a::fnv1a_64(vals.size());
+  for (int64_t v : vals)
+  {
+    hash = fnv1a::fnv1a_64(static_cast<uint64_t>(v), hash);
+  }
+  return static_cast<size_t>(hash);
+}
+
 Node ExampleEvalCache::evaluate(Node bn, unsigned i) const
 {
   Assert(i < d_examples.size());
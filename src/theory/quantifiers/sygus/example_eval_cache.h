@@ -18,7 +18,11 @@
 #ifndef CVC5__THEORY__QUANTIFIERS__EXAMPLE_EVAL_CACHE_H
 #define CVC5__THEORY__QUANTIFIERS__EXAMPLE_EVAL_CACHE_H
 
+#include <memory>
+#include <unordered_map>
+
 #include "expr/node_trie.h"
+#include "theory/quantifiers/sygus/example_column_eval.h"
 #include "theory/quantifiers/sygus/example_infer.h"
 
 namespace cvc5 {
@@ -62,6 +66,10 @@ class TermDbSygus;
  * consider one of them. The interface for querying this is
  *       ExampleEvalCache::addSearchVal(...).
  * For details, see Reynolds et al. SYNT 2017.
+ *
+ * Where possible, terms are evaluated on all examples at once by an
+ * ExampleColumnEval, whose flat results are used to index search values
+ * without constructing the nodes of the results.
  */
 class ExampleEvalCache
 {
@@ -131,7 +139,17 @@ class ExampleEvalCache
 
  private:
   /** Version of evaluateVec that does not do caching */
-  void evaluateVecInternal(Node bv, std::vector<Node>& exOut) const;
+  void evaluateVecInternal(Node bv, std::vector<Node>& exOut);
+  /**
+   * Evaluate bv on all examples using the columnar evaluator. Returns false
+   * if this is not possible, in which case evaluation must use nodes.
+   */
+  bool evaluateFlat(Node bv, std::vector<int64_t>& res);
+  /** Hash function for the flat results of evaluateFlat */
+  struct FlatHashFunction
+  {
+    size_t operator()(const std::vector<int64_t>& vals) const;
+  };
   /** Pointer to the sygus term database */
   TermDbSygus* d_tds;
   /** pointer to the example inference class */
@@ -155,6 +173,16 @@ class ExampleEvalCache
    * about SyGuS datatypes.
    */
   std::map< TypeNode, NodeTrie> d_trie;
+  /**
+   * Maps flat results of evaluateFlat to the term returned by d_trie for them.
+   * This allows finding redundant terms without constructing nodes for
+   * their results.
+   */
+  std::map<TypeNode,
+           std::unordered_map<std::vector<int64_t>, Node, FlatHashFunction>>
+      d_flatIndex;
+  /** The columnar evaluator, constructed on demand */
+  std::unique_ptr<ExampleColumnEval> d_colEval;
   /** cache for evaluate */
   std::map<Node, std::vector<Node>> d_exOutCache;
 };
@@ -45,7 +45,10 @@ CoreSolver::CoreSolver(SolverState& s,
       d_im(im),
       d_termReg(tr),
       d_bsolver(bs),
-      d_nfPairs(s.getSatContext())
+      d_nfPairs(s.getSatContext()),
+      d_hasNfVersion(false),
+      d_nfVersion(0),
+      d_reuseNf(false)
 {
   d_zero = NodeManager::currentNM()->mkConst( Rational( 0 ) );
   d_one = NodeManager::currentNM()->mkConst( Rational( 1 ) );
@@ -122,6 +125,14 @@ struct sortConstLength {
 
 void CoreSolver::checkCycles()
 {
+  d_reuseNf = d_hasNfVersion && d_nfVersion == d_state.getVersion();
+  if (d_reuseNf)
+  {
+    Trace("strings-nf") << "Reuse normal forms, state is unchanged"
+                        << std::endl;
+    return;
+  }
+  d_hasNfVersion = false;
   // first check for cycles, while building ordering of equivalence classes
   d_flat_form.clear();
   d_flat_form_index.clear();
@@ -144,6 +155,10 @@ void CoreSolver::checkCycles()
 
 void CoreSolver::checkFlatForms()
 {
+  if (d_reuseNf)
+  {
+    return;
+  }
   // debug print flat forms
   if (Trace.isOn("strings-ff"))
   {
@@ -541,6 +556,10 @@ Node CoreSolver::checkCycles( Node eqc, std::vector< Node >& curr, std::vector<
 
 void CoreSolver::checkNormalFormsEq()
 {
+  if (d_reuseNf)
+  {
+    return;
+  }
   // calculate normal forms for each equivalence class, possibly adding
   // splitting lemmas
   d_normal_form.clear();
@@ -587,6 +606,12 @@ void CoreSolver::checkNormalFormsEq()
     Trace("strings-process-debug")
         << "Done verifying normal forms are the same for " << eqc << std::endl;
   }
+  if (!d_im.hasProcessed())
+  {
+    // the normal forms are valid until the state changes
+    d_hasNfVersion = true;
+    d_nfVersion = d_state.getVersion();
+  }
   if (Trace.isOn("strings-nf"))
   {
     Trace("strings-nf") << "**** Normal forms are : " << std::endl;
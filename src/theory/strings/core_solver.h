@@ -100,6 +100,12 @@ class CoreSolver
    * in the flat form above, must be empty.
    *
    * For more details, see the inference S-Cycle in Liang et al CAV 2014.
+   *
+   * If the state has not changed since the last call to checkNormalFormsEq
+   * that completed without inferences (see SolverState::getVersion), this
+   * method and the following calls to checkFlatForms and checkNormalFormsEq
+   * do nothing, and the previously computed flat forms and normal forms are
+   * reused, since recomputing them would give the same result.
    */
   void checkCycles();
   /** check flat forms
@@ -520,6 +526,18 @@ class CoreSolver
    * the argument number of the t1 ... tn they were generated from.
    */
   std::map<Node, std::vector<int> > d_flat_form_index;
+  /**
+   * Whether the normal forms computed by the last call to checkNormalFormsEq
+   * are valid for the state with version d_nfVersion.
+   */
+  bool d_hasNfVersion;
+  /** The version of the state for which the normal forms were computed */
+  uint64_t d_nfVersion;
+  /**
+   * Whether the current check reuses the normal forms, which is set by
+   * checkCycles
+   */
+  bool d_reuseNf;
 }; /* class CoreSolver */
 
 }  // namespace strings
@@ -0,0 +1,434 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2021 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Automata for constant regular expressions.
+ */
+
+#include "theory/strings/regexp_automaton.h"
+
+#include <algorithm>
+#include <set>
+
+#include "theory/strings/theory_strings_utils.h"
+#include "util/rational.h"
+
+using namespace cvc5::kind;
+
+namespace cvc5 {
+namespace theory {
+namespace strings {
+
+namespace {
+/** The maximum number of NFA states of an automaton */
+const size_t s_maxNfaStates = 100000;
+/**
+ * The maximum number of DFA states an automaton caches, after which its DFA
+ * is cleared
+ */
+const size_t s_maxDfaStates = 10000;
+/** The maximum number of product states explored by an inclusion check */
+const size_t s_maxProductStates = 100000;
+/** The maximum number of automata in a cache, after which it is cleared */
+const size_t s_maxCachedAutomata = 1000;
+}  // namespace
+
+RegExpAutomaton::RegExpAutomaton() : d_nfaInit(0), d_nfaFinal(0), d_dfaInit(0)
+{
+}
+
+std::unique_ptr<RegExpAutomaton> RegExpAutomaton::mkAutomaton(TNode r)
+{
+  Assert(r.getType().isRegExp());
+  std::unique_ptr<RegExpAutomaton> a(new RegExpAutomaton);
+  a->d_nfaInit = a->mkNfaState();
+  a->d_nfaFinal = a->mkNfaState();
+  if (!a->addRegExp(r, a->d_nfaInit, a->d_nfaFinal))
+  {
+    Trace("re-automaton") << "Unsupported regular expression " << r
+                          << std::endl;
+    return nullptr;
+  }
+  a->computeClasses();
+  std::vector<uint32_t> init{a->d_nfaInit};
+  a->d_dfaInit = a->mkDfaState(init);
+  Trace("re-automaton") << "Automaton for " << r << " has "
+                        << a->d_nfa.size() << " states and "
+                        << a->d_classes.size() << " character classes"
+                        << std::endl;
+  return a;
+}
+
+uint32_t RegExpAutomaton::mkNfaState()
+{
+  d_nfa.emplace_back();
+  return d_nfa.size() - 1;
+}
+
+bool RegExpAutomaton::addRegExp(TNode r, uint32_t start, uint32_t end)
+{
+  // Note that no case below adds transitions into start or out of end, which
+  // ensures that the children of re.++ and re.union may share these states.
+  if (d_nfa.size() > s_maxNfaStates)
+  {
+    return false;
+  }
+  switch (r.getKind())
+  {
+    case REGEXP_EMPTY: return true;
+    case REGEXP_SIGMA:
+    {
+      d_nfa[start].d_trans.emplace_back(0, String::num_codes() - 1, end);
+      return true;
+    }
+    case REGEXP_RANGE:
+    {
+      for (const Node& rc : r)
+      {
+        if (!rc.isConst() || rc.getConst<String>().size() != 1)
+        {
+          return false;
+        }
+      }
+      uint32_t lo = r[0].getConst<String>().front();
+      uint32_t hi = r[1].getConst<String>().front();
+      if (lo <= hi)
+      {
+        d_nfa[start].d_trans.emplace_back(lo, hi, end);
+      }
+      return true;
+    }
+    case STRING_TO_REGEXP:
+    {
+      if (!r[0].isConst())
+      {
+        return false;
+      }
+      const std::vector<unsigned>& vec = r[0].getConst<String>().getVec();
+      if (vec.empty())
+      {
+        d_nfa[start].d_eps.push_back(end);
+        return true;
+      }
+      uint32_t cur = start;
+      for (size_t i = 0, size = vec.size(); i < size; i++)
+      {
+        uint32_t next = i + 1 == size ? end : mkNfaState();
+        d_nfa[cur].d_trans.emplace_back(vec[i], vec[i], next);
+        cur = next;
+      }
+      return true;
+    }
+    case REGEXP_CONCAT:
+    {
+      uint32_t cur = start;
+      for (size_t i = 0, nchild = r.getNumChildren(); i < nchild; i++)
+      {
+        uint32_t next = i + 1 == nchild ? end : mkNfaState();
+        if (!addRegExp(r[i], cur, next))
+        {
+          return false;
+        }
+        cur = next;
+      }
+      return true;
+    }
+    case REGEXP_UNION:
+    {
+      for (const Node& rc : r)
+      {
+        if (!addRegExp(rc, start, end))
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+    case REGEXP_STAR:
+    case REGEXP_PLUS:
+    {
+      uint32_t bodyStart = mkNfaState();
+      uint32_t bodyEnd = mkNfaState();
+      if (!addRegExp(r[0], bodyStart, bodyEnd))
+      {
+        return false;
+      }
+      d_nfa[start].d_eps.push_back(bodyStart);
+      d_nfa[bodyEnd].d_eps.push_back(bodyStart);
+      d_nfa[bodyEnd].d_eps.push_back(end);
+      if (r.getKind() == REGEXP_STAR)
+      {
+        d_nfa[start].d_eps.push_back(end);
+      }
+      return true;
+    }
+    case REGEXP_OPT:
+    {
+      d_nfa[start].d_eps.push_back(end);
+      return addRegExp(r[0], start, end);
+    }
+    case REGEXP_LOOP:
+    case REGEXP_REPEAT:
+    {
+      uint32_t lo, hi;
+      if (r.getKind() == REGEXP_LOOP)
+      {
+        lo = utils::getLoopMinOccurrences(r);
+        hi = utils::getLoopMaxOccurrences(r);
+        if (hi < lo)
+        {
+          // the empty language
+          return true;
+        }
+      }
+      else
+      {
+        lo = utils::getRepeatAmount(r);
+        hi = lo;
+      }
+      // r{lo,hi} is lo copies of r followed by hi-lo optional copies of r
+      uint32_t cur = start;
+      for (uint32_t i = 0; i < hi; i++)
+      {
+        if (i >= lo)
+        {
+          d_nfa[cur].d_eps.push_back(end);
+        }
+        uint32_t next = i + 1 == hi ? end : mkNfaState();
+        if (!addRegExp(r[0], cur, next))
+        {
+          return false;
+        }
+        cur = next;
+      }
+      if (hi == 0)
+      {
+        d_nfa[start].d_eps.push_back(end);
+      }
+      return true;
+    }
+    default:
+      // intersection, complement, and non-constant regular expressions
+      return false;
+  }
+}
+
+void RegExpAutomaton::computeClasses()
+{
+  d_classes.push_back(0);
+  for (const NfaState& s : d_nfa)
+  {
+    for (const std::tuple<uint32_t, uint32_t, uint32_t>& t : s.d_trans)
+    {
+      d_classes.push_back(std::get<0>(t));
+      if (std::get<1>(t) + 1 < String::num_codes())
+      {
+        d_classes.push_back(std::get<1>(t) + 1);
+      }
+    }
+  }
+  std::sort(d_classes.begin(), d_classes.end());
+  d_classes.erase(std::unique(d_classes.begin(), d_classes.end()),
+                  d_classes.end());
+}
+
+uint32_t RegExpAutomaton::getClass(uint32_t c) const
+{
+  Assert(c >= d_classes[0]);
+  return std::upper_bound(d_classes.begin(), d_classes.end(), c)
+         - d_classes.begin() - 1;
+}
+
+uint32_t RegExpAutomaton::mkDfaState(std::vector<uint32_t>& ss)
+{
+  // compute the epsilon closure of ss
+  std::vector<bool> visited(d_nfa.size(), false);
+  std::vector<uint32_t> visit(ss.begin(), ss.end());
+  ss.clear();
+  while (!visit.empty())
+  {
+    uint32_t cur = visit.back();
+    visit.pop_back();
+    if (!visited[cur])
+    {
+      visited[cur] = true;
+      ss.push_back(cur);
+      visit.insert(
+          visit.end(), d_nfa[cur].d_eps.begin(), d_nfa[cur].d_eps.end());
+    }
+  }
+  std::sort(ss.begin(), ss.end());
+  std::map<std::vector<uint32_t>, uint32_t>::iterator it = d_dfaId.find(ss);
+  if (it != d_dfaId.end())
+  {
+    return it->second;
+  }
+  uint32_t ds = d_dfa.size();
+  d_dfaFinal.push_back(std::binary_search(ss.begin(), ss.end(), d_nfaFinal));
+  d_dfaTrans.emplace_back(d_classes.size(), -1);
+  d_dfaId[ss] = ds;
+  d_dfa.push_back(std::move(ss));
+  return ds;
+}
+
+uint32_t RegExpAutomaton::step(uint32_t ds, uint32_t c)
+{
+  uint32_t cl = getClass(c);
+  int64_t next = d_dfaTrans[ds][cl];
+  if (next >= 0)
+  {
+    return next;
+  }
+  std::vector<uint32_t> ss;
+  for (uint32_t s : d_dfa[ds])
+  {
+    for (const std::tuple<uint32_t, uint32_t, uint32_t>& t : d_nfa[s].d_trans)
+    {
+      if (std::get<0>(t) <= c && c <= std::get<1>(t))
+      {
+        ss.push_back(std::get<2>(t));
+      }
+    }
+  }
+  uint32_t nds = mkDfaState(ss);
+  d_dfaTrans[ds][cl] = nds;
+  return nds;
+}
+
+uint32_t RegExpAutomaton::resetDfa(uint32_t ds)
+{
+  Trace("re-automaton") << "Reset DFA cache with " << d_dfa.size()
+                        << " states" << std::endl;
+  std::vector<uint32_t> ss = d_dfa[ds];
+  d_dfa.clear();
+  d_dfaId.clear();
+  d_dfaFinal.clear();
+  d_dfaTrans.clear();
+  std::vector<uint32_t> init{d_nfaInit};
+  d_dfaInit = mkDfaState(init);
+  return mkDfaState(ss);
+}
+
+bool RegExpAutomaton::accepts(const String& s)
+{
+  uint32_t ds = d_dfaInit;
+  for (unsigned c : s.getVec())
+  {
+    if (d_dfa[ds].empty())
+    {
+      // the dead state
+      return false;
+    }
+    if (d_dfa.size() >= s_maxDfaStates)
+    {
+      ds = resetDfa(ds);
+    }
+    ds = step(ds, c);
+  }
+  return d_dfaFinal[ds];
+}
+
+bool RegExpAutomaton::isEmpty() const
+{
+  std::vector<bool> visited(d_nfa.size(), false);
+  std::vector<uint32_t> visit{d_nfaInit};
+  while (!visit.empty())
+  {
+    uint32_t cur = visit.back();
+    visit.pop_back();
+    if (cur == d_nfaFinal)
+    {
+      return false;
+    }
+    if (!visited[cur])
+    {
+      visited[cur] = true;
+      const NfaState& s = d_nfa[cur];
+      visit.insert(visit.end(), s.d_eps.begin(), s.d_eps.end());
+      for (const std::tuple<uint32_t, uint32_t, uint32_t>& t : s.d_trans)
+      {
+        visit.push_back(std::get<2>(t));
+      }
+    }
+  }
+  return true;
+}
+
+bool RegExpAutomaton::includes(RegExpAutomaton& a1,
+                               RegExpAutomaton& a2,
+                               bool& result)
+{
+  // the character classes that distinguish the transitions of both automata
+  std::vector<uint32_t> classes;
+  std::set_union(a1.d_classes.begin(),
+                 a1.d_classes.end(),
+                 a2.d_classes.begin(),
+                 a2.d_classes.end(),
+                 std::back_inserter(classes));
+  // Search for a reachable pair of states that is accepting in a2 and not
+  // accepting in a1. Note that the DFAs are not cleared during the search,
+  // since this invalidates their states.
+  std::set<std::pair<uint32_t, uint32_t>> visited;
+  std::vector<std::pair<uint32_t, uint32_t>> visit{
+      {a1.d_dfaInit, a2.d_dfaInit}};
+  visited.insert(visit.back());
+  while (!visit.empty())
+  {
+    std::pair<uint32_t, uint32_t> cur = visit.back();
+    visit.pop_back();
+    if (a2.d_dfaFinal[cur.second] && !a1.d_dfaFinal[cur.first])
+    {
+      result = false;
+      return true;
+    }
+    if (a2.d_dfa[cur.second].empty())
+    {
+      // a2 accepts no extension of the strings leading to this state
+      continue;
+    }
+    for (uint32_t c : classes)
+    {
+      std::pair<uint32_t, uint32_t> next(a1.step(cur.first, c),
+                                         a2.step(cur.second, c));
+      if (visited.insert(next).second)
+      {
+        visit.push_back(next);
+      }
+    }
+    if (visited.size() > s_maxProductStates
+        || a1.d_dfa.size() > s_maxDfaStates
+        || a2.d_dfa.size() > s_maxDfaStates)
+    {
+      Trace("re-automaton") << "Inclusion check exceeded limit" << std::endl;
+      return false;
+    }
+  }
+  result = true;
+  return true;
+}
+
+std::shared_ptr<RegExpAutomaton> RegExpAutomatonCache::getAutomaton(Node r)
+{
+  std::unordered_map<Node, std::shared_ptr<RegExpAutomaton>>::iterator it =
+      d_automata.find(r);
+  if (it != d_automata.end())
+  {
+    return it->second;
+  }
+  if (d_automata.size() >= s_maxCachedAutomata)
+  {
+    d_automata.clear();
+  }
+  std::shared_ptr<RegExpAutomaton> a = RegExpAutomaton::mkAutomaton(r);
+  d_automata[r] = a;
+  return a;
+}
+
+}  // namespace strings
+}  // namespace theory
+}  // namespace cvc5
@@ -0,0 +1,148 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2021 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Automata for constant regular expressions.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__THEORY__STRINGS__REGEXP_AUTOMATON_H
+#define CVC5__THEORY__STRINGS__REGEXP_AUTOMATON_H
+
+#include <map>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "expr/node.h"
+#include "util/string.h"
+
+namespace cvc5 {
+namespace theory {
+namespace strings {
+
+/**
+ * An automaton for a constant regular expression.
+ *
+ * This class compiles a constant regular expression to a (Thompson) NFA whose
+ * transitions are labeled by ranges of code points. The code point range is
+ * partitioned into character classes, which are the maximal intervals of code
+ * points that no transition of the NFA distinguishes. A DFA over character
+ * classes is then constructed lazily by the subset construction, that is, DFA
+ * states and transitions are only computed when they are first needed, and
+ * are cached for later queries.
+ *
+ * With this, testing membership of a constant string s in the regular
+ * expression takes time linear in the length of s once the relevant part of
+ * the DFA is built, whereas evaluating membership by the recursive definition
+ * (see RegExpEntail::testConstStringInRegExp) may take exponential time.
+ *
+ * Only regular expressions built from str.to_re, re.++, re.union, re.*, re.+,
+ * re.opt, re.range, re.allchar, re.none, re.loop and re.^ are supported.
+ * Intersection and complement are not supported.
+ */
+class RegExpAutomaton
+{
+ public:
+  /**
+   * Make the automaton for regular expression r. Returns nullptr if r is not
+   * a constant regular expression that is supported by this class, or if
+   * its automaton is too large.
+   */
+  static std::unique_ptr<RegExpAutomaton> mkAutomaton(TNode r);
+  /** Does the automaton accept s? */
+  bool accepts(const String& s);
+  /** Is the language of the automaton empty? */
+  bool isEmpty() const;
+  /**
+   * Does the language of a1 include the language of a2? This explores the
+   * product of the DFAs of a1 and a2. Returns true and sets result to the
+   * answer if the exploration finishes within a fixed bound on the number of
+   * product states, and returns false otherwise.
+   */
+  static bool includes(RegExpAutomaton& a1, RegExpAutomaton& a2, bool& result);
+
+ private:
+  RegExpAutomaton();
+  /** A state of the NFA */
+  struct NfaState
+  {
+    /** The epsilon transitions of this state */
+    std::vector<uint32_t> d_eps;
+    /**
+     * The transitions of this state, as tuples (lo, hi, target), where lo and
+     * hi are the (inclusive) bounds of the code points of the transition
+     */
+    std::vector<std::tuple<uint32_t, uint32_t, uint32_t>> d_trans;
+  };
+  /** Make a new NFA state, returns its index */
+  uint32_t mkNfaState();
+  /**
+   * Add the states of r to the NFA, with start state start and final state
+   * end. Returns false if r is not supported or if the NFA is too large.
+   */
+  bool addRegExp(TNode r, uint32_t start, uint32_t end);
+  /** Compute the character classes, after the NFA is built */
+  void computeClasses();
+  /** Get the character class of code point c */
+  uint32_t getClass(uint32_t c) const;
+  /** Get the DFA state for the epsilon closure of the NFA states in ss */
+  uint32_t mkDfaState(std::vector<uint32_t>& ss);
+  /** Get the DFA state reached from DFA state ds by code point c */
+  uint32_t step(uint32_t ds, uint32_t c);
+  /** Clear the DFA cache, except for the DFA state ds, which is returned */
+  uint32_t resetDfa(uint32_t ds);
+  /** The states of the NFA */
+  std::vector<NfaState> d_nfa;
+  /** The initial state of the NFA */
+  uint32_t d_nfaInit;
+  /** The (unique) final state of the NFA */
+  uint32_t d_nfaFinal;
+  /** The first code point of each character class, in increasing order */
+  std::vector<uint32_t> d_classes;
+  /** Maps each DFA state to its set of NFA states, sorted */
+  std::vector<std::vector<uint32_t>> d_dfa;
+  /** Maps sets of NFA states to their DFA state */
+  std::map<std::vector<uint32_t>, uint32_t> d_dfaId;
+  /** Whether each DFA state is accepting */
+  std::vector<bool> d_dfaFinal;
+  /**
+   * The transitions of each DFA state, indexed by character class, where
+   * a negative value means that the transition was not computed yet
+   */
+  std::vector<std::vector<int64_t>> d_dfaTrans;
+  /** The initial DFA state */
+  uint32_t d_dfaInit;
+};
+
+/**
+ * A cache of automata for constant regular expressions, keyed by regular
+ * expression. The cache is cleared when it holds too many automata, hence
+ * automata are shared with the callers, which may keep them alive.
+ */
+class RegExpAutomatonCache
+{
+ public:
+  /**
+   * Get the automaton for r, or nullptr if r is not supported by
+   * RegExpAutomaton.
+   */
+  std::shared_ptr<RegExpAutomaton> getAutomaton(Node r);
+
+ private:
+  /** Maps regular expressions to their automaton, if any */
+  std::unordered_map<Node, std::shared_ptr<RegExpAutomaton>> d_automata;
+};
+
+}  // namespace strings
+}  // namespace theory
+}  // namespace cvc5
+
+#endif /* CVC5__THEORY__STRINGS__REGEXP_AUTOMATON_H */
@@ -1569,6 +1569,18 @@ bool RegExpOpr::regExpIncludes(Node r1, Node r2)
     return (*it).second;
   }
   bool result = RegExpEntail::regExpIncludes(r1, r2);
+  if (!result && RegExpEntail::isConstRegExp(r1)
+      && RegExpEntail::isConstRegExp(r2))
+  {
+    // the above check is incomplete, use automata if possible
+    std::shared_ptr<RegExpAutomaton> a1 = d_automata.getAutomaton(r1);
+    std::shared_ptr<RegExpAutomaton> a2 =
+        a1 == nullptr ? nullptr : d_automata.getAutomaton(r2);
+    if (a2 != nullptr)
+    {
+      RegExpAutomaton::includes(*a1, *a2, result);
+    }
+  }
   d_inclusionCache[std::make_pair(r1, r2)] = result;
   return result;
 }
@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "expr/node.h"
+#include "theory/strings/regexp_automaton.h"
 #include "theory/strings/skolem_cache.h"
 #include "util/string.h"
 
@@ -83,6 +84,8 @@ class RegExpOpr {
   std::map<PairNodes, Node> d_inter_cache;
   std::map<Node, std::vector<PairNodes> > d_split_cache;
   std::map<PairNodes, bool> d_inclusionCache;
+  /** automata for constant regular expressions, used for inclusion checks */
+  RegExpAutomatonCache d_automata;
   /**
    * Helper function for mkString, pretty prints constant or variable regular
    * expression r.
@@ -339,8 +339,11 @@ bool RegExpSolver::checkEqcInclusion(std::vector<Node>& mems)
 
     for (const Node& m2 : mems)
     {
-      if (m1 == m2)
+      if (m1 == m2 || remove.find(m2) != remove.end())
       {
+        // Skip memberships marked for removal, since two memberships whose
+        // regular expressions are equivalent include each other, and only
+        // one of them may be dropped.
         continue;
       }
 
@@ -1188,7 +1188,9 @@ Node SequencesRewriter::rewriteMembership(TNode node)
   {
     // test whether x in node[1]
     cvc5::String s = x.getConst<String>();
-    bool test = RegExpEntail::testConstStringInRegExp(s, 0, r);
+    std::shared_ptr<RegExpAutomaton> a = d_reAutomata.getAutomaton(r);
+    bool test = a != nullptr ? a->accepts(s)
+                             : RegExpEntail::testConstStringInRegExp(s, 0, r);
     Node retNode = NodeManager::currentNM()->mkConst(test);
     return returnRewrite(node, retNode, Rewrite::RE_IN_EVAL);
   }
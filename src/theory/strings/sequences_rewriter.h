@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "expr/node.h"
+#include "theory/strings/regexp_automaton.h"
 #include "theory/strings/rewrites.h"
 #include "theory/strings/sequences_stats.h"
 #include "theory/strings/strings_entail.h"
@@ -303,6 +304,9 @@ class SequencesRewriter : public TheoryRewriter
 
   /** Instance of the entailment checker for strings. */
   StringsEntail d_stringsEntail;
+
+  /** Automata for evaluating memberships in constant regular expressions. */
+  RegExpAutomatonCache d_reAutomata;
 }; /* class SequencesRewriter */
 
 }  // namespace strings
@@ -31,7 +31,12 @@ namespace strings {
 SolverState::SolverState(context::Context* c,
                          context::UserContext* u,
                          Valuation& v)
-    : TheoryState(c, u, v), d_eeDisequalities(c), d_pendingConflictSet(c, false), d_pendingConflict(InferenceId::UNKNOWN)
+    : TheoryState(c, u, v),
+      d_eeDisequalities(c),
+      d_version(c, 0),
+      d_versionCounter(0),
+      d_pendingConflictSet(c, false),
+      d_pendingConflict(InferenceId::UNKNOWN)
 {
   d_zero = NodeManager::currentNM()->mkConst(Rational(0));
   d_false = NodeManager::currentNM()->mkConst(false);
@@ -55,6 +60,10 @@ void SolverState::addDisequality(TNode t1, TNode t2)
   d_eeDisequalities.push_back(t1.eqNode(t2));
 }
 
+void SolverState::notifyChanged() { d_version = ++d_versionCounter; }
+
+uint64_t SolverState::getVersion() const { return d_version.get(); }
+
 EqcInfo* SolverState::getOrMakeEqcInfo(Node eqc, bool doMake)
 {
   std::map<Node, EqcInfo*>::iterator eqc_i = d_eqcInfo.find(eqc);
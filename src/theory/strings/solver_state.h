@@ -64,6 +64,21 @@ class SolverState : public TheoryState
    */
   void addDisequality(TNode t1, TNode t2);
   //-------------------------------------- end disequality information
+  //-------------------------------------- version
+  /**
+   * Notify the state that the equality engine or the asserted facts have
+   * changed. This is called on new equivalence classes, merges and facts.
+   */
+  void notifyChanged();
+  /**
+   * Get the version of the current state. Two calls to this method return the
+   * same value only if there was no change (see notifyChanged) between them,
+   * or if all changes between them were undone by backtracking. Hence, this
+   * can be used to determine whether a result computed for the current state
+   * is still valid.
+   */
+  uint64_t getVersion() const;
+  //-------------------------------------- end version
   //------------------------------------------ conflicts
   /** set pending prefix conflict
    *
@@ -152,6 +167,10 @@ class SolverState : public TheoryState
    * to the equality engine above.
    */
   NodeList d_eeDisequalities;
+  /** The version of the current state, see getVersion */
+  context::CDO<uint64_t> d_version;
+  /** The last version we allocated */
+  uint64_t d_versionCounter;
   /** The pending conflict if one exists */
   context::CDO<bool> d_pendingConflictSet;
   /** The pending conflict, valid if the above flag is true */
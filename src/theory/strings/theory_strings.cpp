@@ -603,6 +603,7 @@ void TheoryStrings::notifyFact(TNode atom,
                                TNode fact,
                                bool isInternal)
 {
+  d_state.notifyChanged();
   d_eagerSolver.notifyFact(atom, polarity, fact, isInternal);
   // process pending conflicts due to reasoning about endpoints
   if (!d_state.isInConflict() && d_state.hasPendingConflict())
@@ -698,6 +699,7 @@ void TheoryStrings::conflict(TNode a, TNode b){
 }
 
 void TheoryStrings::eqNotifyNewClass(TNode t){
+  d_state.notifyChanged();
   Kind k = t.getKind();
   if (k == STRING_LENGTH || k == STRING_TO_CODE)
   {
@@ -161,11 +161,13 @@ class TheoryStrings : public Theory {
     {
       Debug("strings") << "NotifyClass::eqNotifyMerge(" << t1 << ", " << t2
                        << std::endl;
+      d_str.d_state.notifyChanged();
       d_eagerSolver.eqNotifyMerge(t1, t2);
     }
     void eqNotifyDisequal(TNode t1, TNode t2, TNode reason) override
     {
       Debug("strings") << "NotifyClass::eqNotifyDisequal(" << t1 << ", " << t2 << ", " << reason << std::endl;
+      d_str.d_state.notifyChanged();
       d_eagerSolver.eqNotifyDisequal(t1, t2, reason);
     }
 
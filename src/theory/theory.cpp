@@ -285,24 +285,32 @@ void Theory::notifyInConflict()
 
 void Theory::computeCareGraph() {
   Debug("sharing") << "Theory::computeCareGraph<" << getId() << ">()" << endl;
+  // We don't care about the terms of different types, hence we index the
+  // shared terms by type
+  std::map<TypeNode, std::vector<TNode>> typeTerms;
   for (unsigned i = 0; i < d_sharedTerms.size(); ++ i) {
     TNode a = d_sharedTerms[i];
-    TypeNode aType = a.getType();
-    for (unsigned j = i + 1; j < d_sharedTerms.size(); ++ j) {
-      TNode b = d_sharedTerms[j];
-      if (b.getType() != aType) {
-        // We don't care about the terms of different types
-        continue;
-      }
-      switch (d_valuation.getEqualityStatus(a, b)) {
-      case EQUALITY_TRUE_AND_PROPAGATED:
-      case EQUALITY_FALSE_AND_PROPAGATED:
-        // If we know about it, we should have propagated it, so we can skip
-        break;
-      default:
-        // Let's split on it
-        addCarePair(a, b);
-        break;
+    typeTerms[a.getType()].push_back(a);
+  }
+  for (const std::pair<const TypeNode, std::vector<TNode>>& tt : typeTerms)
+  {
+    const std::vector<TNode>& terms = tt.second;
+    for (size_t i = 0, nterms = terms.size(); i < nterms; ++i)
+    {
+      TNode a = terms[i];
+      for (size_t j = i + 1; j < nterms; ++j)
+      {
+        TNode b = terms[j];
+        switch (d_valuation.getEqualityStatus(a, b)) {
+        case EQUALITY_TRUE_AND_PROPAGATED:
+        case EQUALITY_FALSE_AND_PROPAGATED:
+          // If we know about it, we should have propagated it, so we can skip
+          break;
+        default:
+          // Let's split on it
+          addCarePair(a, b);
+          break;
+        }
       }
     }
   }
@@ -15,6 +15,7 @@
 
 #include "theory/theory_engine.h"
 
+#include <fstream>
 #include <sstream>
 
 #include "base/map_util.h"
@@ -44,6 +45,7 @@
 #include "theory/theory.h"
 #include "theory/theory_engine_proof_generator.h"
 #include "theory/theory_id.h"
+#include "theory/theory_inference_manager.h"
 #include "theory/theory_model.h"
 #include "theory/theory_traits.h"
 #include "theory/uf/equality_engine.h"
@@ -777,6 +779,13 @@ void TheoryEngine::shutdown() {
   // matters.
   d_hasShutDown = true;
 
+  const std::string& profileFile = options::inferenceProfileFile();
+  if (!profileFile.empty())
+  {
+    std::ofstream out(profileFile);
+    printInferenceProfile(out);
+  }
+
   // Shutdown all the theories
   for(TheoryId theoryId = theory::THEORY_FIRST; theoryId < theory::THEORY_LAST; ++theoryId) {
     if(d_theoryTable[theoryId]) {
@@ -785,6 +794,22 @@ void TheoryEngine::shutdown() {
   }
 }
 
+void TheoryEngine::printInferenceProfile(std::ostream& out) const
+{
+  out << "theory,inference,conflicts,conflictSize,lemmas,lemmaSize,lemmaTime"
+      << std::endl;
+  for (TheoryId theoryId = theory::THEORY_FIRST;
+       theoryId < theory::THEORY_LAST;
+       ++theoryId)
+  {
+    Theory* t = d_theoryTable[theoryId];
+    if (t != nullptr && t->getInferenceManager() != nullptr)
+    {
+      t->getInferenceManager()->printProfile(out);
+    }
+  }
+}
+
 theory::Theory::PPAssertStatus TheoryEngine::solve(
     TrustNode tliteral, TrustSubstitutionMap& substitutionOut)
 {
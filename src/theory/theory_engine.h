@@ -472,6 +472,12 @@ class TheoryEngine {
    * ordering issues between PropEngine and Theory.
    */
   void shutdown();
+  /**
+   * Print the inference profile of all theories as comma-separated values,
+   * see TheoryInferenceManager::printProfile. This is written to the file
+   * given by --inference-profile-file at shutdown.
+   */
+  void printInferenceProfile(std::ostream& out) const;
 
   /**
    * Solve the given literal with a theory that owns it. The proof of tliteral
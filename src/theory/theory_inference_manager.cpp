@@ -15,6 +15,11 @@
 
 #include "theory/theory_inference_manager.h"
 
+#include <algorithm>
+#include <sstream>
+#include <unordered_set>
+
+#include "options/theory_options.h"
 #include "smt/smt_engine_scope.h"
 #include "smt/smt_statistics_registry.h"
 #include "theory/output_channel.h"
@@ -29,6 +34,27 @@ using namespace cvc5::kind;
 namespace cvc5 {
 namespace theory {
 
+namespace {
+
+/** Get the number of distinct subterms of n */
+uint64_t getDagSize(TNode n)
+{
+  std::unordered_set<TNode> visited;
+  std::vector<TNode> visit{n};
+  do
+  {
+    TNode cur = visit.back();
+    visit.pop_back();
+    if (visited.insert(cur).second)
+    {
+      visit.insert(visit.end(), cur.begin(), cur.end());
+    }
+  } while (!visit.empty());
+  return visited.size();
+}
+
+}  // namespace
+
 TheoryInferenceManager::TheoryInferenceManager(Theory& t,
                                                TheoryState& state,
                                                ProofNodeManager* pnm,
@@ -43,6 +69,7 @@ TheoryInferenceManager::TheoryInferenceManager(Theory& t,
       d_cacheLemmas(cacheLemmas),
       d_keep(t.getSatContext()),
       d_lemmasSent(t.getUserContext()),
+      d_clauses(t.getUserContext()),
       d_numConflicts(0),
       d_numCurrentLemmas(0),
       d_numCurrentFacts(0),
@@ -51,7 +78,16 @@ TheoryInferenceManager::TheoryInferenceManager(Theory& t,
       d_factIdStats(smtStatisticsRegistry().registerHistogram<InferenceId>(
           statsName + "inferencesFact")),
       d_lemmaIdStats(smtStatisticsRegistry().registerHistogram<InferenceId>(
-          statsName + "inferencesLemma"))
+          statsName + "inferencesLemma")),
+      d_lemmaIdDuplicateStats(
+          smtStatisticsRegistry().registerHistogram<InferenceId>(
+              statsName + "inferencesLemmaDuplicate")),
+      d_lemmaIdSubsumedStats(
+          smtStatisticsRegistry().registerHistogram<InferenceId>(
+              statsName + "inferencesLemmaSubsumed")),
+      d_statsName(statsName),
+      d_profileEnabled(options::inferenceProfile()
+                       || !options::inferenceProfileFile().empty())
 {
   // don't add true lemma
   Node truen = NodeManager::currentNM()->mkConst(true);
@@ -62,6 +98,42 @@ TheoryInferenceManager::~TheoryInferenceManager()
 {
 }
 
+TheoryInferenceManager::InferenceProfile::InferenceProfile(
+    const std::string& name)
+    : d_conflicts(smtStatisticsRegistry().registerInt(name + "::conflicts")),
+      d_conflictSize(
+          smtStatisticsRegistry().registerInt(name + "::conflictSize")),
+      d_lemmas(smtStatisticsRegistry().registerInt(name + "::lemmas")),
+      d_lemmaSize(smtStatisticsRegistry().registerInt(name + "::lemmaSize")),
+      d_lemmaTime(smtStatisticsRegistry().registerTimer(name + "::lemmaTime"))
+{
+}
+
+TheoryInferenceManager::InferenceProfile& TheoryInferenceManager::getProfile(
+    InferenceId id)
+{
+  auto it = d_profile.find(id);
+  if (it == d_profile.end())
+  {
+    // statistics are registered for the inferences that actually occur only
+    std::stringstream name;
+    name << d_statsName << "inferenceProfile::" << id;
+    it = d_profile.emplace(id, InferenceProfile(name.str())).first;
+  }
+  return it->second;
+}
+
+void TheoryInferenceManager::printProfile(std::ostream& out) const
+{
+  for (const std::pair<const InferenceId, InferenceProfile>& p : d_profile)
+  {
+    const InferenceProfile& ip = p.second;
+    out << d_theory.getId() << "," << p.first << "," << ip.d_conflicts.get()
+        << "," << ip.d_conflictSize.get() << "," << ip.d_lemmas.get() << ","
+        << ip.d_lemmaSize.get() << "," << ip.d_lemmaTime.get() << std::endl;
+  }
+}
+
 void TheoryInferenceManager::setEqualityEngine(eq::EqualityEngine* ee)
 {
   d_ee = ee;
@@ -119,6 +191,12 @@ void TheoryInferenceManager::conflict(TNode conf, InferenceId id)
 void TheoryInferenceManager::trustedConflict(TrustNode tconf, InferenceId id)
 {
   d_conflictIdStats << id;
+  if (d_profileEnabled)
+  {
+    InferenceProfile& ip = getProfile(id);
+    ++ip.d_conflicts;
+    ip.d_conflictSize += getDagSize(tconf.getNode());
+  }
   smt::currentResourceManager()->spendResource(id);
   Trace("im") << "(conflict " << id << " " << tconf.getProven() << ")"
               << std::endl;
@@ -247,6 +325,14 @@ bool TheoryInferenceManager::trustedLemma(const TrustNode& tlem,
   {
     if (!cacheLemma(tlem.getNode(), p))
     {
+      d_lemmaIdDuplicateStats << id;
+      return false;
+    }
+    if (options::lemmaSubsumption() && isSubsumedLemma(tlem.getNode(), p))
+    {
+      Trace("im") << "(lemma-subsumed " << id << " " << tlem.getProven() << ")"
+                  << std::endl;
+      d_lemmaIdSubsumedStats << id;
       return false;
     }
   }
@@ -254,6 +340,16 @@ bool TheoryInferenceManager::trustedLemma(const TrustNode& tlem,
   smt::currentResourceManager()->spendResource(id);
   Trace("im") << "(lemma " << id << " " << tlem.getProven() << ")" << std::endl;
   d_numCurrentLemmas++;
+  if (!d_profileEnabled)
+  {
+    d_out.trustedLemma(tlem, p);
+    return true;
+  }
+  InferenceProfile& ip = getProfile(id);
+  ++ip.d_lemmas;
+  ip.d_lemmaSize += getDagSize(tlem.getNode());
+  // sending a lemma may recursively send lemmas of the same kind
+  TimerStat::CodeTimer codeTimer(ip.d_lemmaTime, true);
   d_out.trustedLemma(tlem, p);
   return true;
 }
@@ -499,6 +595,64 @@ bool TheoryInferenceManager::cacheLemma(TNode lem, LemmaProperty p)
   return true;
 }
 
+bool TheoryInferenceManager::isSubsumedLemma(TNode lem, LemmaProperty p)
+{
+  Node rewritten = Rewriter::rewrite(lem);
+  std::vector<Node> lits;
+  if (rewritten.getKind() == OR)
+  {
+    lits.insert(lits.end(), rewritten.begin(), rewritten.end());
+    std::sort(lits.begin(), lits.end());
+    lits.erase(std::unique(lits.begin(), lits.end()), lits.end());
+  }
+  else
+  {
+    lits.push_back(rewritten);
+  }
+  std::unordered_set<Node> litSet(lits.begin(), lits.end());
+  for (const Node& l : lits)
+  {
+    std::unordered_map<Node, std::vector<std::pair<size_t, Node>>>::iterator
+        it = d_clauseIndex.find(l);
+    if (it == d_clauseIndex.end())
+    {
+      continue;
+    }
+    std::vector<std::pair<size_t, Node>>& clauses = it->second;
+    for (size_t i = 0; i < clauses.size();)
+    {
+      const std::pair<size_t, Node>& c = clauses[i];
+      if (c.first >= d_clauses.size() || d_clauses[c.first] != c.second)
+      {
+        // removed by a user pop
+        clauses[i] = clauses.back();
+        clauses.pop_back();
+        continue;
+      }
+      if (c.second.getKind() != OR
+          || std::all_of(c.second.begin(), c.second.end(), [&](TNode cl) {
+               return litSet.find(cl) != litSet.end();
+             }))
+      {
+        // either a unit clause that is a literal of lem, or all literals of
+        // the clause are literals of lem
+        return true;
+      }
+      ++i;
+    }
+  }
+  // the clauses of removable lemmas may be deleted by the SAT solver, hence
+  // they do not subsume other clauses
+  if (!isLemmaPropertyRemovable(p))
+  {
+    Node clause = lits.size() == 1 ? lits[0]
+                                   : NodeManager::currentNM()->mkNode(OR, lits);
+    d_clauseIndex[lits[0]].emplace_back(d_clauses.size(), clause);
+    d_clauses.push_back(clause);
+  }
+  return false;
+}
+
 DecisionManager* TheoryInferenceManager::getDecisionManager()
 {
   return d_decManager;
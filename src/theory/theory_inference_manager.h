@@ -18,9 +18,13 @@
 #ifndef CVC5__THEORY__THEORY_INFERENCE_MANAGER_H
 #define CVC5__THEORY__THEORY_INFERENCE_MANAGER_H
 
+#include <map>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 #include "context/cdhashset.h"
+#include "context/cdlist.h"
 #include "expr/node.h"
 #include "proof/proof_rule.h"
 #include "proof/trust_node.h"
@@ -291,6 +295,14 @@ class TheoryInferenceManager
   uint32_t numSentLemmas() const;
   /** Have we added a lemma since the last call to reset? */
   bool hasSentLemma() const;
+  /**
+   * Print the profile of the inferences sent via this inference manager as
+   * lines of comma-separated values of the form
+   *   theory,inference,conflicts,conflictSize,lemmas,lemmaSize,lemmaTime
+   * where lemmaTime is in milliseconds. Prints nothing unless
+   * --inference-profile is enabled.
+   */
+  void printProfile(std::ostream& out) const;
   //--------------------------------------- internal facts
   /**
    * Assert internal fact. This is recommended method for asserting "internal"
@@ -423,6 +435,13 @@ class TheoryInferenceManager
    * override this method to take the lemma property into account as needed.
    */
   virtual bool cacheLemma(TNode lem, LemmaProperty p);
+  /**
+   * Is the clause of lemma lem subsumed by the clause of a (non-removable)
+   * lemma that was sent in this user context? The clause of a lemma is the
+   * set of disjuncts of its rewritten form. If lem is not subsumed and p is
+   * not removable, its clause is added to the index d_clauses.
+   */
+  bool isSubsumedLemma(TNode lem, LemmaProperty p);
   /** The theory object */
   Theory& d_theory;
   /** Reference to the state of theory */
@@ -451,6 +470,20 @@ class TheoryInferenceManager
    * nodes. Notice that this cache does not depedent on lemma property.
    */
   NodeSet d_lemmasSent;
+  /**
+   * The clauses of the non-removable lemmas sent in this user context, as
+   * disjunctions whose children are ordered.
+   */
+  context::CDList<Node> d_clauses;
+  /**
+   * Maps literals to the clauses in d_clauses whose first literal it is,
+   * given as pairs of their index in d_clauses and the clause. Since each
+   * clause is indexed once, a clause that subsumes a clause C is found by
+   * looking up the literals of C. The entries whose index is not below the
+   * size of d_clauses, or for which d_clauses holds another clause, were
+   * removed by popping the user context, and are removed lazily.
+   */
+  std::unordered_map<Node, std::vector<std::pair<size_t, Node>>> d_clauseIndex;
   /** The number of conflicts sent since the last call to reset. */
   uint32_t d_numConflicts;
   /** The number of lemmas sent since the last call to reset. */
@@ -463,6 +496,40 @@ class TheoryInferenceManager
   HistogramStat<InferenceId> d_factIdStats;
   /** Statistics for lemmas sent via this inference manager. */
   HistogramStat<InferenceId> d_lemmaIdStats;
+  /** Statistics for lemmas not sent since they were sent before. */
+  HistogramStat<InferenceId> d_lemmaIdDuplicateStats;
+  /** Statistics for lemmas not sent since they were subsumed. */
+  HistogramStat<InferenceId> d_lemmaIdSubsumedStats;
+  /**
+   * The profile of the inferences with a given identifier, if
+   * --inference-profile is enabled. The size of a formula is the number of
+   * its distinct subterms.
+   */
+  struct InferenceProfile
+  {
+    InferenceProfile(const std::string& name);
+    /** Number of conflicts sent */
+    IntStat d_conflicts;
+    /** Total size of the conflicts sent */
+    IntStat d_conflictSize;
+    /** Number of lemmas sent */
+    IntStat d_lemmas;
+    /** Total size of the lemmas sent */
+    IntStat d_lemmaSize;
+    /**
+     * Time for processing the lemmas sent, which includes their preprocessing
+     * and conversion to clauses
+     */
+    TimerStat d_lemmaTime;
+  };
+  /** Get the profile of the inferences with identifier id */
+  InferenceProfile& getProfile(InferenceId id);
+  /** The prefix of the names of the statistics of this inference manager */
+  std::string d_statsName;
+  /** Whether we profile inferences */
+  bool d_profileEnabled;
+  /** The profiles of the inferences sent via this inference manager */
+  std::map<InferenceId, InferenceProfile> d_profile;
 };
 
 }  // namespace theory
@@ -475,6 +475,7 @@ SortModel::SortModel(Node n,
       d_split_score(d_state.getSatContext()),
       d_disequalities_index(d_state.getSatContext(), 0),
       d_reps(d_state.getSatContext(), 0),
+      d_sym_break_index(d_state.getUserContext()),
       d_cardinality(d_state.getSatContext(), 1),
       d_hasCard(d_state.getSatContext(), false),
       d_maxNegCard(d_state.getSatContext(), 0),
@@ -715,6 +716,15 @@ void SortModel::check(Theory::Effort level)
       }
     }
   }
+  if (d_hasCard && applyTotality(d_cardinality))
+  {
+    // add totality axioms for all representatives, if we have not done so
+    // already, otherwise we fall back to splitting on demand
+    if (level != Theory::EFFORT_FULL || addTotalityAxioms())
+    {
+      return;
+    }
+  }
   // do splitting on demand
   bool addedLemma = false;
   if (level == Theory::EFFORT_FULL)
@@ -1088,6 +1098,91 @@ void SortModel::addCliqueLemma(std::vector<Node>& clique)
   }
 }
 
+bool SortModel::applyTotality(uint32_t c)
+{
+  return options::ufssTotalityLimited() >= 0
+         && c <= static_cast<uint32_t>(options::ufssTotalityLimited());
+}
+
+bool SortModel::addTotalityAxioms()
+{
+  Assert(d_hasCard);
+  NodeManager* nm = NodeManager::currentNM();
+  uint32_t c = d_cardinality;
+  Node cl = getCardinalityLiteral(c);
+  std::vector<Node> terms;
+  for (size_t i = 0; i < c; i++)
+  {
+    terms.push_back(getTotalityTerm(i));
+  }
+  bool addedLemma = false;
+  for (NodeIntMap::iterator it = d_regions_map.begin();
+       it != d_regions_map.end();
+       ++it)
+  {
+    if (!isValid((*it).second))
+    {
+      // not a representative
+      continue;
+    }
+    Node n = (*it).first;
+    if (d_totality_index.find(n) != d_totality_index.end())
+    {
+      // The totality terms r_1, ..., r_c trivially satisfy their axiom. The
+      // terms r_{c+1}, ... were introduced for larger bounds, e.g. before
+      // backtracking to c, and are skipped, since constraining them would
+      // invalidate the permutation argument for symmetry breaking. The
+      // cardinality of the sort is still enforced for them by splitting.
+      continue;
+    }
+    size_t k = c;
+    if (options::ufssTotalitySymBreak())
+    {
+      NodeSizeMap::const_iterator its = d_sym_break_index.find(n);
+      size_t index;
+      if (its == d_sym_break_index.end())
+      {
+        index = d_sym_break_index.size() + 1;
+        Trace("uf-ss-totality") << "Allocate symmetry breaking term " << n
+                                << ", index = " << index << std::endl;
+        d_sym_break_index.insert(n, index);
+      }
+      else
+      {
+        index = (*its).second;
+      }
+      k = std::min(k, index);
+    }
+    std::vector<Node> eqs;
+    for (size_t i = 0; i < k; i++)
+    {
+      eqs.push_back(n.eqNode(terms[i]));
+    }
+    Node lem = nm->mkNode(IMPLIES, cl, nm->mkOr(eqs));
+    if (d_im.lemma(lem, InferenceId::UF_CARD_TOTALITY))
+    {
+      Trace("uf-ss-lemma") << "*** Add totality axiom " << lem << std::endl;
+      ++(d_thss->d_statistics.d_totality_lemmas);
+      addedLemma = true;
+    }
+  }
+  return addedLemma;
+}
+
+Node SortModel::getTotalityTerm(size_t i)
+{
+  while (d_totality_terms.size() <= i)
+  {
+    std::stringstream ss;
+    ss << "r_" << d_type << "_" << d_totality_terms.size() + 1;
+    Node r = NodeManager::currentNM()->getSkolemManager()->mkDummySkolem(
+        ss.str(), d_type, "is a term used in totality axioms");
+    d_totality_index[r] = d_totality_terms.size();
+    d_totality_terms.push_back(r);
+  }
+  return d_totality_terms[i];
+}
+
 void SortModel::simpleCheckCardinality() {
   if( d_maxNegCard.get()!=0 && d_hasCard.get() && d_cardinality.get()<d_maxNegCard.get() ){
     Node lem = NodeManager::currentNM()->mkNode( AND, getCardinalityLiteral( d_cardinality.get() ),
@@ -1499,7 +1594,18 @@ void CardinalityExtension::check(Theory::Effort level)
         }
       }
       for( std::map< TypeNode, SortModel* >::iterator it = d_rep_model.begin(); it != d_rep_model.end(); ++it ){
-        it->second->check(level);
+        SortModel* sm = it->second;
+        if (sm->hasCardinalityAsserted())
+        {
+          uint32_t c = sm->getCardinality();
+          d_statistics.d_bound_checks << c;
+          TimerStat::CodeTimer codeTimer(d_statistics.getBoundTimer(c));
+          sm->check(level);
+        }
+        else
+        {
+          sm->check(level);
+        }
         if (d_state.isInConflict())
         {
           break;
@@ -1756,11 +1862,29 @@ CardinalityExtension::Statistics::Statistics()
       d_split_lemmas(smtStatisticsRegistry().registerInt(
           "CardinalityExtension::Split_Lemmas")),
       d_max_model_size(smtStatisticsRegistry().registerInt(
-          "CardinalityExtension::Max_Model_Size"))
+          "CardinalityExtension::Max_Model_Size")),
+      d_totality_lemmas(smtStatisticsRegistry().registerInt(
+          "CardinalityExtension::Totality_Lemmas")),
+      d_bound_checks(smtStatisticsRegistry().registerHistogram<uint32_t>(
+          "CardinalityExtension::Bound_Checks"))
 {
   d_max_model_size.maxAssign(1);
 }
 
+TimerStat& CardinalityExtension::Statistics::getBoundTimer(uint32_t c)
+{
+  std::map<uint32_t, TimerStat>::iterator it = d_bound_time.find(c);
+  if (it == d_bound_time.end())
+  {
+    std::stringstream ss;
+    ss << "CardinalityExtension::Bound_" << c << "_Time";
+    it = d_bound_time
+             .emplace(c, smtStatisticsRegistry().registerTimer(ss.str()))
+             .first;
+  }
+  return it->second;
+}
+
 }  // namespace uf
 }  // namespace theory
 }  // namespace cvc5
@@ -41,6 +41,7 @@ class CardinalityExtension
  protected:
   typedef context::CDHashMap<Node, bool> NodeBoolMap;
   typedef context::CDHashMap<Node, int> NodeIntMap;
+  typedef context::CDHashMap<Node, size_t> NodeSizeMap;
 
  public:
   /**
@@ -49,11 +50,6 @@ class CardinalityExtension
    */
   class SortModel
   {
-   private:
-    std::map< Node, std::vector< int > > d_totality_lems;
-    std::map< TypeNode, std::map< int, std::vector< Node > > > d_sym_break_terms;
-    std::map< Node, int > d_sym_break_index;
-
    public:
     /**
      * A partition of the current equality graph for which cliques
@@ -262,6 +258,43 @@ class CardinalityExtension
     int addSplit(Region* r);
     /** add clique lemma */
     void addCliqueLemma(std::vector<Node>& clique);
+    /** Are totality axioms used for cardinality c? */
+    static bool applyTotality(uint32_t c);
+    /**
+     * Add the totality axioms for the representatives of this sort that are
+     * not totality terms, for the current cardinality c, which are of the form
+     *   (card_T c) => (or (= t r_1) ... (= t r_k))
+     * where r_1, ..., r_c are the totality terms of this sort. If symmetry
+     * breaking is enabled, k is the minimum of c and the symmetry breaking
+     * index of t, and k=c otherwise.
+     *
+     * Since these axioms are guarded by cardinality literals, they remain
+     * valid, together with the clauses learned from them, when the
+     * cardinality bound is increased.
+     *
+     * @return true if a lemma was sent.
+     */
+    bool addTotalityAxioms();
+    /** get the totality term r_{i+1} */
+    Node getTotalityTerm(size_t i);
+    /** The fresh terms r_1, r_2, ... used in totality axioms */
+    std::vector<Node> d_totality_terms;
+    /** Maps the terms in d_totality_terms to their index */
+    std::unordered_map<Node, size_t> d_totality_index;
+    /**
+     * Maps terms to their symmetry breaking index, which is one plus the
+     * number of terms that were allocated an index before them. Any model
+     * can be permuted such that each term t is equal to one of
+     * r_1, ..., r_k where k is the index of t, by assigning the totality
+     * terms to the values of the terms in the order of their indices.
+     *
+     * This map depends on the user context, as do the totality axioms
+     * that mention the indices, so that indices are reallocated when those
+     * axioms are popped. It does not depend on the SAT context, since
+     * axioms sent under different SAT contexts would otherwise use the same
+     * index for different terms.
+     */
+    NodeSizeMap d_sym_break_index;
     /** cardinality */
     context::CDO<uint32_t> d_cardinality;
     /** cardinality lemma term */
@@ -396,7 +429,16 @@ class CardinalityExtension
     IntStat d_clique_lemmas;
     IntStat d_split_lemmas;
     IntStat d_max_model_size;
+    IntStat d_totality_lemmas;
+    /** The number of checks per cardinality bound */
+    HistogramStat<uint32_t> d_bound_checks;
+    /** Get the timer for the checks at cardinality bound c */
+    TimerStat& getBoundTimer(uint32_t c);
     Statistics();
+
+   private:
+    /** The timers for the checks per cardinality bound */
+    std::map<uint32_t, TimerStat> d_bound_time;
   };
   /** statistics class */
   Statistics d_statistics;
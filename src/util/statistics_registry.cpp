@@ -17,12 +17,125 @@
 
 #include "util/statistics_registry.h"
 
+#include <cmath>
+#include <iomanip>
+
 #include "options/base_options.h"
+#include "util/ostream_util.h"
 #include "util/statistics_public.h"
 
 namespace cvc5 {
 
+namespace {
+
+/** Print s as a JSON string literal */
+void printJsonString(std::ostream& os, const std::string& s)
+{
+  os << '"';
+  for (unsigned char c : s)
+  {
+    if (c == '"' || c == '\\')
+    {
+      os << '\\' << c;
+    }
+    else if (c < 0x20)
+    {
+      os << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+         << static_cast<uint32_t>(c) << std::dec << std::setfill(' ');
+    }
+    else
+    {
+      os << c;
+    }
+  }
+  os << '"';
+}
+
+/**
+ * Get the value of sbv for a JSON snapshot. Unlike the viewer, this returns
+ * the number of milliseconds for timers, so that deltas can be computed, and
+ * strings for non-finite doubles.
+ */
+StatExportData getJsonValue(const StatisticBaseValue& sbv)
+{
+  if (const auto* timer = dynamic_cast<const StatisticTimerValue*>(&sbv))
+  {
+    return static_cast<int64_t>(timer->get());
+  }
+  StatExportData val = sbv.getViewer();
+  if (const auto* dval = std::get_if<double>(&val))
+  {
+    // JSON has no numbers for NaN and infinity, we use strings instead
+    if (std::isnan(*dval))
+    {
+      return std::string("nan");
+    }
+    if (std::isinf(*dval))
+    {
+      return std::string(*dval > 0 ? "inf" : "-inf");
+    }
+  }
+  return val;
+}
+
+/**
+ * Print the delta between the old value (if any) and the new value of a
+ * statistic to os, prefixed by its name.
+ */
+void printJsonDelta(std::ostream& os,
+                    const std::string& name,
+                    const StatExportData* oldval,
+                    const StatExportData& newval)
+{
+  printJsonString(os, name);
+  os << ":";
+  if (const auto* ival = std::get_if<int64_t>(&newval))
+  {
+    int64_t old = oldval == nullptr ? 0 : std::get<int64_t>(*oldval);
+    os << (*ival - old);
+  }
+  else if (const auto* dval = std::get_if<double>(&newval))
+  {
+    os << *dval;
+  }
+  else if (const auto* sval = std::get_if<std::string>(&newval))
+  {
+    printJsonString(os, *sval);
+  }
+  else
+  {
+    const auto& hist = std::get<std::map<std::string, uint64_t>>(newval);
+    const std::map<std::string, uint64_t>* oldhist =
+        oldval == nullptr
+            ? nullptr
+            : &std::get<std::map<std::string, uint64_t>>(*oldval);
+    os << "{";
+    bool first = true;
+    for (const auto& e : hist)
+    {
+      uint64_t old = 0;
+      if (oldhist != nullptr)
+      {
+        auto it = oldhist->find(e.first);
+        old = it == oldhist->end() ? 0 : it->second;
+      }
+      if (e.second == old)
+      {
+        continue;
+      }
+      if (!first) os << ",";
+      first = false;
+      printJsonString(os, e.first);
+      os << ":" << (static_cast<int64_t>(e.second) - static_cast<int64_t>(old));
+    }
+    os << "}";
+  }
+}
+
+}  // namespace
+
 StatisticsRegistry::StatisticsRegistry(bool registerPublic)
+    : d_created(std::chrono::steady_clock::now())
 {
   if (registerPublic)
   {
@@ -146,6 +259,42 @@ void StatisticsRegistry::printDiff(std::ostream& os) const
   }
 }
 
+void StatisticsRegistry::printJsonSnapshot(std::ostream& os, uint64_t query)
+{
+  // restore the formatting of os after printing the time
+  StreamFormatScope formatScope(os);
+  auto now = std::chrono::system_clock::now();
+  auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - d_created);
+  os << "{\"time\":" << std::fixed << std::setprecision(3)
+     << std::chrono::duration<double>(now.time_since_epoch()).count()
+     << std::defaultfloat << std::setprecision(6)
+     << ",\"elapsed\":" << elapsed.count() << ",\"query\":" << query
+     << ",\"stats\":{";
+  if constexpr (Configuration::isStatisticsBuild())
+  {
+    bool first = true;
+    for (const auto& s : d_stats)
+    {
+      if (!options::statisticsExpert() && s.second->d_expert) continue;
+      StatExportData val = getJsonValue(*s.second);
+      auto oldit = d_lastJsonSnapshot.find(s.first);
+      const StatExportData* oldval =
+          oldit == d_lastJsonSnapshot.end() ? nullptr : &oldit->second;
+      if (oldval == nullptr ? s.second->isDefault() : *oldval == val)
+      {
+        // unchanged, nothing to report
+        continue;
+      }
+      if (!first) os << ",";
+      first = false;
+      printJsonDelta(os, s.first, oldval, val);
+      d_lastJsonSnapshot[s.first] = std::move(val);
+    }
+  }
+  os << "}}" << std::endl;
+}
+
 std::ostream& operator<<(std::ostream& os, const StatisticsRegistry& sr)
 {
   sr.print(os);
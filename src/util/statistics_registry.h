@@ -68,6 +68,7 @@
 #ifndef CVC5__STATISTICS_REGISTRY_H
 #define CVC5__STATISTICS_REGISTRY_H
 
+#include <chrono>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -224,6 +225,17 @@ class StatisticsRegistry
    * Print all statistics as a diff to the last stored snapshot.
    */
   void printDiff(std::ostream& os) const;
+  /**
+   * Print the changes to all statistics since the last call to this method
+   * as a single line of JSON to the given output stream. The line contains
+   * the wall-clock time (in seconds since the epoch), the time elapsed since
+   * the creation of this registry (in milliseconds), the given query index and
+   * an object `stats` that maps every statistic that changed to its delta:
+   * the difference for integer statistics and timers (in milliseconds), the
+   * difference of every entry for histograms, and the new value otherwise.
+   * This snapshot is independent of the one used by `printDiff()`.
+   */
+  void printJsonSnapshot(std::ostream& os, uint64_t query);
 
  private:
   /**
@@ -261,6 +273,10 @@ class StatisticsRegistry
   std::map<std::string, std::unique_ptr<StatisticBaseValue>> d_stats;
 
   std::unique_ptr<Snapshot> d_lastSnapshot;
+  /** The snapshot taken by the last call to `printJsonSnapshot()` */
+  Snapshot d_lastJsonSnapshot;
+  /** The time this registry was created, for `printJsonSnapshot()` */
+  std::chrono::steady_clock::time_point d_created;
 };
 
 /** Calls `sr.print(os)`. */
@@ -114,6 +114,14 @@ bool TimerStat::running() const
   }
   return false;
 }
+uint64_t TimerStat::get() const
+{
+  if constexpr (Configuration::isStatisticsBuild())
+  {
+    return d_data->get();
+  }
+  return 0;
+}
 
 CodeTimer::CodeTimer(TimerStat& timer, bool allow_reentrant)
     : d_timer(timer), d_reentrant(false)
@@ -223,6 +223,8 @@ class TimerStat
   void stop();
   /** Checks whether the timer is running. */
   bool running() const;
+  /** Get the accumulated time in milliseconds, including a running timer. */
+  uint64_t get() const;
 
  private:
   /** Construct from a pointer to the internal data */
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -40,6 +41,16 @@ String::String(const std::wstring& s)
 }
 
 String::String(const std::vector<unsigned> &s) : d_str(s)
+{
+  checkCodePoints();
+}
+
+String::String(std::vector<unsigned>&& s) : d_str(std::move(s))
+{
+  checkCodePoints();
+}
+
+void String::checkCodePoints() const
 {
 #ifdef CVC5_ASSERTIONS
   for (unsigned u : d_str)
@@ -49,24 +60,39 @@ String::String(const std::vector<unsigned> &s) : d_str(s)
 #endif
 }
 
+bool String::equalRange(std::size_t i,
+                        const String& y,
+                        std::size_t j,
+                        std::size_t n) const
+{
+  Assert(i + n <= size() && j + n <= y.size());
+  // memcmp is typically vectorized, and suffices since we only test equality
+  return n == 0
+         || std::memcmp(
+                d_str.data() + i, y.d_str.data() + j, n * sizeof(unsigned))
+                == 0;
+}
+
 int String::cmp(const String &y) const {
   if (size() != y.size()) {
     return size() < y.size() ? -1 : 1;
   }
-  for (unsigned int i = 0; i < size(); ++i) {
-    if (d_str[i] != y.d_str[i]) {
-      unsigned cp = d_str[i];
-      unsigned cpy = y.d_str[i];
-      return cp < cpy ? -1 : 1;
-    }
+  if (equalRange(0, y, 0, size()))
+  {
+    return 0;
   }
-  return 0;
+  std::pair<std::vector<unsigned>::const_iterator,
+            std::vector<unsigned>::const_iterator>
+      mm = std::mismatch(d_str.begin(), d_str.end(), y.d_str.begin());
+  return *mm.first < *mm.second ? -1 : 1;
 }
 
 String String::concat(const String &other) const {
-  std::vector<unsigned int> ret_vec(d_str);
+  std::vector<unsigned int> ret_vec;
+  ret_vec.reserve(size() + other.size());
+  ret_vec.insert(ret_vec.end(), d_str.begin(), d_str.end());
   ret_vec.insert(ret_vec.end(), other.d_str.begin(), other.d_str.end());
-  return String(ret_vec);
+  return String(std::move(ret_vec));
 }
 
 bool String::strncmp(const String& y, std::size_t n) const
@@ -80,10 +106,7 @@ bool String::strncmp(const String& y, std::size_t n) const
       return false;
     }
   }
-  for (std::size_t i = 0; i < n; ++i) {
-    if (d_str[i] != y.d_str[i]) return false;
-  }
-  return true;
+  return equalRange(0, y, 0, n);
 }
 
 bool String::rstrncmp(const String& y, std::size_t n) const
@@ -97,10 +120,7 @@ bool String::rstrncmp(const String& y, std::size_t n) const
       return false;
     }
   }
-  for (std::size_t i = 0; i < n; ++i) {
-    if (d_str[size() - i - 1] != y.d_str[y.size() - i - 1]) return false;
-  }
-  return true;
+  return equalRange(size() - n, y, y.size() - n, n);
 }
 
 void String::addCharToInternal(unsigned char ch, std::vector<unsigned>& str)
@@ -260,9 +280,8 @@ unsigned String::back() const
 std::size_t String::overlap(const String &y) const {
   std::size_t i = size() < y.size() ? size() : y.size();
   for (; i > 0; i--) {
-    String s = suffix(i);
-    String p = y.prefix(i);
-    if (s == p) {
+    if (equalRange(size() - i, y, 0, i))
+    {
       return i;
     }
   }
@@ -272,9 +291,8 @@ std::size_t String::overlap(const String &y) const {
 std::size_t String::roverlap(const String &y) const {
   std::size_t i = size() < y.size() ? size() : y.size();
   for (; i > 0; i--) {
-    String s = prefix(i);
-    String p = y.suffix(i);
-    if (s == p) {
+    if (equalRange(0, y, y.size() - i, i))
+    {
       return i;
     }
   }
@@ -363,10 +381,19 @@ std::size_t String::find(const String &y, const std::size_t start) const {
   if (y.empty()) return start;
   if (empty()) return std::string::npos;
 
-  std::vector<unsigned>::const_iterator itr = std::search(
-      d_str.begin() + start, d_str.end(), y.d_str.begin(), y.d_str.end());
-  if (itr != d_str.end()) {
-    return itr - d_str.begin();
+  // find the occurrences of the first character of y, and compare the rest
+  unsigned first = y.d_str[0];
+  std::size_t ys = y.size();
+  std::vector<unsigned>::const_iterator last = d_str.end() - (ys - 1);
+  for (std::vector<unsigned>::const_iterator itr = d_str.begin() + start;
+       (itr = std::find(itr, last, first)) != last;
+       ++itr)
+  {
+    std::size_t i = itr - d_str.begin();
+    if (equalRange(i + 1, y, 1, ys - 1))
+    {
+      return i;
+    }
   }
   return std::string::npos;
 }
@@ -392,14 +419,7 @@ bool String::hasPrefix(const String& y) const
   {
     return false;
   }
-  for (size_t i = 0; i < ys; i++)
-  {
-    if (d_str[i] != y.d_str[i])
-    {
-      return false;
-    }
-  }
-  return true;
+  return equalRange(0, y, 0, ys);
 }
 
 bool String::hasSuffix(const String& y) const
@@ -410,15 +430,7 @@ bool String::hasSuffix(const String& y) const
   {
     return false;
   }
-  size_t idiff = s - ys;
-  for (size_t i = 0; i < ys; i++)
-  {
-    if (d_str[i + idiff] != y.d_str[i])
-    {
-      return false;
-    }
-  }
-  return true;
+  return equalRange(s - ys, y, 0, ys);
 }
 
 String String::update(std::size_t i, const String& t) const
@@ -437,7 +449,7 @@ String String::update(std::size_t i, const String& t) const
       vec.insert(vec.end(), t.d_str.begin(), t.d_str.end());
       vec.insert(vec.end(), d_str.begin() + i + tnum, d_str.end());
     }
-    return String(vec);
+    return String(std::move(vec));
   }
   return *this;
 }
@@ -449,7 +461,7 @@ String String::replace(const String &s, const String &t) const {
     vec.insert(vec.begin(), d_str.begin(), d_str.begin() + ret);
     vec.insert(vec.end(), t.d_str.begin(), t.d_str.end());
     vec.insert(vec.end(), d_str.begin() + ret + s.size(), d_str.end());
-    return String(vec);
+    return String(std::move(vec));
   } else {
     return *this;
   }
@@ -457,18 +469,14 @@ String String::replace(const String &s, const String &t) const {
 
 String String::substr(std::size_t i) const {
   Assert(i <= size());
-  std::vector<unsigned> ret_vec;
   std::vector<unsigned>::const_iterator itr = d_str.begin() + i;
-  ret_vec.insert(ret_vec.end(), itr, d_str.end());
-  return String(ret_vec);
+  return String(std::vector<unsigned>(itr, d_str.end()));
 }
 
 String String::substr(std::size_t i, std::size_t j) const {
   Assert(i + j <= size());
-  std::vector<unsigned> ret_vec;
   std::vector<unsigned>::const_iterator itr = d_str.begin() + i;
-  ret_vec.insert(ret_vec.end(), itr, itr + j);
-  return String(ret_vec);
+  return String(std::vector<unsigned>(itr, itr + j));
 }
 
 bool String::noOverlapWith(const String& y) const
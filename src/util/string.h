@@ -20,6 +20,7 @@
 
 #include <iosfwd>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "util/rational.h"
@@ -75,6 +76,7 @@ class String
   {
   }
   explicit String(const std::vector<unsigned>& s);
+  explicit String(std::vector<unsigned>&& s);
 
   String& operator=(const String& y) {
     if (this != &y) {
@@ -259,6 +261,16 @@ class String
    * positive number if *this > y.
    */
   int cmp(const String& y) const;
+  /**
+   * Returns true if the n characters of this string starting at index i are
+   * equal to the n characters of y starting at index j.
+   */
+  bool equalRange(std::size_t i,
+                  const String& y,
+                  std::size_t j,
+                  std::size_t n) const;
+  /** Assert that all characters of this string are valid code points */
+  void checkCodePoints() const;
 
   std::vector<unsigned> d_str;
 }; /* class String */
@@ -269,7 +281,11 @@ struct StringHashFunction
 {
   size_t operator()(const ::cvc5::String& s) const
   {
-    return std::hash<std::string>()(s.toString());
+    // hash the code points directly, instead of converting s to a std::string
+    const std::vector<unsigned>& vec = s.getVec();
+    return std::hash<std::string_view>()(
+        std::string_view(reinterpret_cast<const char*>(vec.data()),
+                         vec.size() * sizeof(unsigned)));
   }
 }; /* struct StringHashFunction */
 
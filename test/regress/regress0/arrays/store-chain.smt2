@@ -0,0 +1,33 @@
+; EXPECT: unsat
+(set-logic QF_ALIA)
+(declare-fun a0 () (Array Int Int))
+(declare-fun b () (Array Int Int))
+(declare-fun x () Int)
+(define-fun a1 () (Array Int Int) (store a0 1 (+ x 1)))
+(define-fun a2 () (Array Int Int) (store a1 2 (+ x 2)))
+(define-fun a3 () (Array Int Int) (store a2 3 (+ x 3)))
+(define-fun a4 () (Array Int Int) (store a3 4 (+ x 4)))
+(define-fun a5 () (Array Int Int) (store a4 5 (+ x 5)))
+(define-fun a6 () (Array Int Int) (store a5 6 (+ x 6)))
+(define-fun a7 () (Array Int Int) (store a6 7 (+ x 7)))
+(define-fun a8 () (Array Int Int) (store a7 8 (+ x 8)))
+(define-fun a9 () (Array Int Int) (store a8 9 (+ x 9)))
+(define-fun a10 () (Array Int Int) (store a9 10 (+ x 10)))
+(define-fun a11 () (Array Int Int) (store a10 11 (+ x 11)))
+(define-fun a12 () (Array Int Int) (store a11 12 (+ x 12)))
+(assert (= b (store a12 0 x)))
+(assert (or
+  (not (= (select b 1) (+ x 1)))
+  (not (= (select b 2) (+ x 2)))
+  (not (= (select b 3) (+ x 3)))
+  (not (= (select b 4) (+ x 4)))
+  (not (= (select b 5) (+ x 5)))
+  (not (= (select b 6) (+ x 6)))
+  (not (= (select b 7) (+ x 7)))
+  (not (= (select b 8) (+ x 8)))
+  (not (= (select b 9) (+ x 9)))
+  (not (= (select b 10) (+ x 10)))
+  (not (= (select b 11) (+ x 11)))
+  (not (= (select b 12) (+ x 12)))
+  (not (= (select b 0) (select (store a0 0 x) 0)))))
+(check-sat)
@@ -0,0 +1,74 @@
+; COMMAND-LINE: --incremental
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_DTLIA)
+(declare-datatype Lst ((nil) (cons (hd Int) (tl Lst))))
+(declare-fun x0 () Lst)
+(declare-fun x1 () Lst)
+(declare-fun x2 () Lst)
+(declare-fun x3 () Lst)
+(declare-fun x4 () Lst)
+(declare-fun x5 () Lst)
+(declare-fun x6 () Lst)
+(declare-fun x7 () Lst)
+(declare-fun x8 () Lst)
+(declare-fun x9 () Lst)
+(declare-fun x10 () Lst)
+(declare-fun x11 () Lst)
+(declare-fun x12 () Lst)
+(declare-fun x13 () Lst)
+(declare-fun x14 () Lst)
+(declare-fun x15 () Lst)
+(declare-fun x16 () Lst)
+(declare-fun x17 () Lst)
+(declare-fun x18 () Lst)
+(declare-fun x19 () Lst)
+(declare-fun x20 () Lst)
+(declare-fun x21 () Lst)
+(declare-fun x22 () Lst)
+(declare-fun x23 () Lst)
+(declare-fun x24 () Lst)
+(declare-fun x25 () Lst)
+(declare-fun x26 () Lst)
+(declare-fun x27 () Lst)
+(declare-fun x28 () Lst)
+(declare-fun x29 () Lst)
+(declare-fun x30 () Lst)
+(assert (= x0 (cons 0 x1)))
+(assert (= x1 (cons 1 x2)))
+(assert (= x2 (cons 2 x3)))
+(assert (= x3 (cons 3 x4)))
+(assert (= x4 (cons 4 x5)))
+(assert (= x5 (cons 5 x6)))
+(assert (= x6 (cons 6 x7)))
+(assert (= x7 (cons 7 x8)))
+(assert (= x8 (cons 8 x9)))
+(assert (= x9 (cons 9 x10)))
+(assert (= x10 (cons 10 x11)))
+(assert (= x11 (cons 11 x12)))
+(assert (= x12 (cons 12 x13)))
+(assert (= x13 (cons 13 x14)))
+(assert (= x14 (cons 14 x15)))
+(assert (= x15 (cons 15 x16)))
+(assert (= x16 (cons 16 x17)))
+(assert (= x17 (cons 17 x18)))
+(assert (= x18 (cons 18 x19)))
+(assert (= x19 (cons 19 x20)))
+(assert (= x20 (cons 20 x21)))
+(assert (= x21 (cons 21 x22)))
+(assert (= x22 (cons 22 x23)))
+(assert (= x23 (cons 23 x24)))
+(assert (= x24 (cons 24 x25)))
+(assert (= x25 (cons 25 x26)))
+(assert (= x26 (cons 26 x27)))
+(assert (= x27 (cons 27 x28)))
+(assert (= x28 (cons 28 x29)))
+(assert (= x29 (cons 29 x30)))
+(check-sat)
+(push 1)
+(assert (or (= x30 x0) (= x30 x15)))
+(check-sat)
+(pop 1)
+(assert (not (= x30 nil)))
+(check-sat)
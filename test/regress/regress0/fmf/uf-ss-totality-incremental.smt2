@@ -0,0 +1,23 @@
+; COMMAND-LINE: --incremental --finite-model-find --uf-ss-totality-limited=4 --uf-ss-totality-sym-break
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic UF)
+(declare-sort U 0)
+(declare-fun a () U)
+(declare-fun b () U)
+(declare-fun c () U)
+(declare-fun f (U) U)
+(assert (distinct a b c))
+(assert (forall ((x U)) (not (= (f x) x))))
+; bounds 1 and 2 fail before a model of size 3 is found
+(check-sat)
+(push 1)
+; at most two elements
+(assert (forall ((x U) (y U) (z U)) (or (= x y) (= x z) (= y z))))
+(check-sat)
+(pop 1)
+; symmetry breaking indices are allocated again after the pop
+(declare-fun d () U)
+(assert (distinct a b c d))
+(check-sat)
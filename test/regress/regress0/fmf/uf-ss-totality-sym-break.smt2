@@ -0,0 +1,12 @@
+; COMMAND-LINE: --finite-model-find --uf-ss-totality-limited=4 --uf-ss-totality-sym-break
+; EXPECT: sat
+(set-logic UF)
+(declare-sort U 0)
+(declare-fun a () U)
+(declare-fun b () U)
+(declare-fun c () U)
+(declare-fun f (U) U)
+(assert (distinct a b c))
+(assert (forall ((x U)) (not (= (f x) x))))
+(assert (= (f (f a)) b))
+(check-sat)
@@ -0,0 +1,10 @@
+; COMMAND-LINE: --nl-ext=none --nl-cad --nl-cad-sample-cells=4
+; REQUIRES: poly
+; EXPECT: sat
+(set-logic QF_NRA)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(assert (> (* x x) 2.0))
+(assert (< (* x y) 1.0))
+(assert (> (+ (* y y) x) 3.0))
+(check-sat)
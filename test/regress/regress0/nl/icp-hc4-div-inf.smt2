@@ -0,0 +1,10 @@
+; COMMAND-LINE: --nl-ext=none --nl-icp-hc4
+; EXPECT: unsat
+(set-logic QF_NRA)
+(declare-fun x () Real)
+(declare-fun y () Real)
+; projecting onto x divides [-oo, 5] by [-oo, -1]
+(assert (<= (* x y) 5.0))
+(assert (<= y (- 1.0)))
+(assert (< x (- 6.0)))
+(check-sat)
@@ -0,0 +1,10 @@
+; COMMAND-LINE: --nl-ext=none --nl-icp-hc4
+; EXPECT: unsat
+(set-logic QF_NRA)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+(assert (and (<= 0.0 x) (<= x 2.0) (<= 0.0 y) (<= y 2.0)))
+(assert (= z (* x y)))
+(assert (>= (+ z (* x x)) 9.0))
+(check-sat)
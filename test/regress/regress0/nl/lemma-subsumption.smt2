@@ -0,0 +1,11 @@
+; COMMAND-LINE: --lemma-subsumption --nl-ext=full
+; EXPECT: unsat
+(set-logic QF_NIA)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+(assert (> x 1))
+(assert (> y 1))
+(assert (> z 1))
+(assert (< (* x y z) (* x y)))
+(check-sat)
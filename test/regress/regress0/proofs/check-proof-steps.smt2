@@ -0,0 +1,12 @@
+; COMMAND-LINE: --check-proofs --check-proof-steps
+; EXPECT: unsat
+(set-logic QF_UFLIA)
+(declare-fun f (Int) Int)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun p () Bool)
+(assert (= x (+ y 1)))
+(assert (or p (= (f x) (f (+ y 1)))))
+(assert (or (not p) (> x (+ y 2))))
+(assert (not (= (f x) (f (+ y 1)))))
+(check-sat)
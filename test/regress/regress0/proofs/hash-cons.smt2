@@ -0,0 +1,16 @@
+; REQUIRES: statistics
+; COMMAND-LINE: --proof-hash-cons --check-proofs
+; SCRUBBER: sed -n -E -e 's/.*ProofNodeManager::sharedNodes[^0-9]*[1-9].*/shared proof nodes/p' -e '/^unsat$/p'
+; EXPECT: unsat
+; EXPECT: shared proof nodes
+(set-logic QF_UFLIA)
+(declare-fun f (Int) Int)
+(declare-fun a () Int)
+(declare-fun b () Int)
+(declare-fun c () Int)
+(assert (= a b))
+(assert (= b c))
+(assert (or (not (= (f a) (f c))) (not (= (f (f a)) (f (f c))))))
+(assert (or (> (f a) (f b)) (< (f (f b)) (f (f c)))))
+(check-sat)
+(get-info :all-statistics)
@@ -0,0 +1,16 @@
+; COMMAND-LINE: --dump-proofs --proof-format-mode=steps --proof-print-conclusion
+; SCRUBBER: sed -n -E -e '/^\(step /{h;d}' -e '/^\)$/{x;s/@p[0-9]+/@p/g;p;x}' -e p
+; EXPECT: unsat
+; EXPECT: (proof
+; EXPECT: (step @p :rule SCOPE :premises (@p) :args ((= a b) (= b c) (not (= (f a) (f c)))) :conclusion (not (and (= a b) (= b c) (not (= (f a) (f c))))))
+; EXPECT: )
+(set-logic QF_UF)
+(declare-sort U 0)
+(declare-fun f (U) U)
+(declare-fun a () U)
+(declare-fun b () U)
+(declare-fun c () U)
+(assert (= a b))
+(assert (= b c))
+(assert (not (= (f a) (f c))))
+(check-sat)
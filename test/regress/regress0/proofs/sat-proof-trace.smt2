@@ -0,0 +1,38 @@
+; COMMAND-LINE: --sat-proof-trace --check-proofs
+; EXPECT: unsat
+(set-logic QF_UF)
+(declare-fun p00 () Bool)
+(declare-fun p01 () Bool)
+(declare-fun p02 () Bool)
+(declare-fun p10 () Bool)
+(declare-fun p11 () Bool)
+(declare-fun p12 () Bool)
+(declare-fun p20 () Bool)
+(declare-fun p21 () Bool)
+(declare-fun p22 () Bool)
+(declare-fun p30 () Bool)
+(declare-fun p31 () Bool)
+(declare-fun p32 () Bool)
+(assert (or p00 p01 p02))
+(assert (or p10 p11 p12))
+(assert (or p20 p21 p22))
+(assert (or p30 p31 p32))
+(assert (or (not p00) (not p10)))
+(assert (or (not p00) (not p20)))
+(assert (or (not p00) (not p30)))
+(assert (or (not p10) (not p20)))
+(assert (or (not p10) (not p30)))
+(assert (or (not p20) (not p30)))
+(assert (or (not p01) (not p11)))
+(assert (or (not p01) (not p21)))
+(assert (or (not p01) (not p31)))
+(assert (or (not p11) (not p21)))
+(assert (or (not p11) (not p31)))
+(assert (or (not p21) (not p31)))
+(assert (or (not p02) (not p12)))
+(assert (or (not p02) (not p22)))
+(assert (or (not p02) (not p32)))
+(assert (or (not p12) (not p22)))
+(assert (or (not p12) (not p32)))
+(assert (or (not p22) (not p32)))
+(check-sat)
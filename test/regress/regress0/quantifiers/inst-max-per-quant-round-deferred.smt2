@@ -0,0 +1,14 @@
+; REQUIRES: no-competition
+; COMMAND-LINE: -o inst --inst-max-per-quant-round=1 --no-quant-cf --no-check-unsat-cores
+; EXPECT: (num-instantiations myQuant 1)
+; EXPECT: (num-instantiations-deferred myQuant 1)
+; EXPECT: unsat
+
+; E-matching finds the instances for 1 and 2 in the first round, only one of
+; which is sent under the limit. Either of them is a conflict.
+(set-logic UFLIA)
+(declare-fun P (Int) Bool)
+(assert (forall ((x Int)) (! (not (P x)) :qid |myQuant|)))
+(assert (P 1))
+(assert (P 2))
+(check-sat)
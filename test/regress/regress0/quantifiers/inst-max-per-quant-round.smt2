@@ -0,0 +1,10 @@
+; COMMAND-LINE: --inst-max-per-quant-round=1
+; EXPECT: unsat
+(set-logic UFLIA)
+(declare-fun P (Int) Bool)
+(declare-fun Q (Int) Bool)
+(assert (forall ((x Int)) (=> (P x) (Q x))))
+(assert (forall ((x Int)) (=> (Q x) (P (+ x 1)))))
+(assert (P 0))
+(assert (not (P 3)))
+(check-sat)
@@ -0,0 +1,21 @@
+; COMMAND-LINE: --incremental
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_SLIA)
+(declare-fun x () String)
+(declare-fun y () String)
+(declare-fun z () String)
+(declare-fun n () Int)
+(assert (= (str.++ x "ab") (str.++ "ab" y)))
+(assert (= n (str.len x)))
+(assert (> n 2))
+(check-sat)
+(push 1)
+; the normal forms computed for the previous check must not be reused here
+(assert (= x (str.++ y "c")))
+(check-sat)
+(pop 1)
+(assert (= z (str.++ x y)))
+(assert (< (str.len z) 8))
+(check-sat)
@@ -0,0 +1,12 @@
+; COMMAND-LINE: --strings-exp --no-re-elim
+(set-info :status unsat)
+(set-logic QF_SLIA)
+(declare-const x String)
+
+; the two regular expressions are equivalent, hence they include each other,
+; but at least one of the memberships must be kept
+(assert (str.in_re x (re.* (str.to_re "ab"))))
+(assert (str.in_re x (re.union (str.to_re "") (re.++ (str.to_re "ab") (re.* (str.to_re "ab"))))))
+(assert (= (str.len x) 3))
+
+(check-sat)
@@ -0,0 +1,14 @@
+; COMMAND-LINE: --tc-model-phase
+; EXPECT: unsat
+(set-logic QF_UFLIA)
+(declare-fun f (Int) Int)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+(assert (<= 0 x 1))
+(assert (<= 0 y 1))
+(assert (<= 0 z 1))
+(assert (distinct (f x) (f y)))
+(assert (distinct (f y) (f z)))
+(assert (distinct (f x) (f z)))
+(check-sat)
@@ -13,6 +13,8 @@
  * Black box testing of the Solver class of the  C++ API.
  */
 
+#include <sstream>
+
 #include "test_api.h"
 
 namespace cvc5 {
@@ -2300,5 +2302,83 @@ TEST_F(TestApiBlackSolver, tupleProject)
       projection.toString());
 }
 
+TEST_F(TestApiBlackSolver, printStatisticsSnapshot)
+{
+  std::stringstream ss;
+  ASSERT_NO_THROW(d_solver.printStatisticsSnapshot(ss));
+  ASSERT_EQ(ss.str().rfind("{\"time\":", 0), 0);
+  ASSERT_NE(ss.str().find(",\"query\":0,\"stats\":{"), std::string::npos);
+
+  Term x = d_solver.mkConst(d_solver.getIntegerSort(), "x");
+  d_solver.assertFormula(d_solver.mkTerm(GT, x, d_solver.mkInteger(0)));
+  d_solver.checkSat();
+  ss.str("");
+  ASSERT_NO_THROW(d_solver.printStatisticsSnapshot(ss));
+  std::string snapshot = ss.str();
+  ASSERT_NE(snapshot.find(",\"query\":1,\"stats\":{"), std::string::npos);
+  // a single line
+  ASSERT_EQ(snapshot.find('\n'), snapshot.size() - 1);
+  ASSERT_EQ(snapshot.substr(snapshot.size() - 3), "}}\n");
+}
+
+TEST_F(TestApiBlackSolver, dumpLoadPreprocessedAssertions)
+{
+  Sort intSort = d_solver.getIntegerSort();
+  Term x = d_solver.mkConst(intSort, "x");
+  Term y = d_solver.mkConst(intSort, "y");
+  Term f = d_solver.mkConst(d_solver.mkFunctionSort(intSort, intSort), "f");
+  Term one = d_solver.mkInteger(1);
+  d_solver.assertFormula(
+      d_solver.mkTerm(EQUAL, x, d_solver.mkTerm(PLUS, y, one)));
+  d_solver.assertFormula(d_solver.mkTerm(GT, x, d_solver.mkInteger(5)));
+  d_solver.assertFormula(d_solver.mkTerm(
+      LT, d_solver.mkTerm(APPLY_UF, f, y), d_solver.mkInteger(0)));
+  std::stringstream ss;
+  ASSERT_NO_THROW(d_solver.dumpPreprocessedAssertions(ss));
+
+  Solver slv;
+  slv.setOption("produce-models", "true");
+  std::vector<Term> decls;
+  ASSERT_NO_THROW(decls = slv.loadPreprocessedAssertions(ss));
+  ASSERT_EQ(decls.size(), 3);
+  Term rx, ry;
+  for (const Term& d : decls)
+  {
+    ASSERT_NE(d, x);
+    if (d.toString() == "x")
+    {
+      rx = d;
+    }
+    else if (d.toString() == "y")
+    {
+      ry = d;
+    }
+  }
+  ASSERT_FALSE(rx.isNull());
+  ASSERT_FALSE(ry.isNull());
+  ASSERT_EQ(rx.getSort(), intSort);
+  ASSERT_TRUE(slv.checkSat().isSat());
+  // eliminated variables get their values from the loaded substitutions
+  int64_t vx = slv.getValue(rx).getInt64Value();
+  int64_t vy = slv.getValue(ry).getInt64Value();
+  ASSERT_EQ(vx, vy + 1);
+  ASSERT_GT(vx, 5);
+
+  std::stringstream garbage("not preprocessed assertions");
+  ASSERT_THROW(slv.loadPreprocessedAssertions(garbage), CVC5ApiException);
+
+  Solver cores;
+  cores.setOption("produce-unsat-cores", "true");
+  std::stringstream ss2;
+  d_solver.dumpPreprocessedAssertions(ss2);
+  ASSERT_THROW(cores.loadPreprocessedAssertions(ss2), CVC5ApiException);
+
+  Solver negate;
+  negate.setOption("global-negate", "true");
+  negate.assertFormula(negate.mkTrue());
+  std::stringstream ss3;
+  ASSERT_THROW(negate.dumpPreprocessedAssertions(ss3), CVC5ApiException);
+}
+
 }  // namespace test
 }  // namespace cvc5
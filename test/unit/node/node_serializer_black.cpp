@@ -0,0 +1,258 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2021 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Black box testing of node_serializer.{h,cpp}
+ */
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "base/exception.h"
+#include "expr/node_manager.h"
+#include "expr/node_serializer.h"
+#include "test_node.h"
+#include "theory/bv/theory_bv_utils.h"
+#include "util/bitvector.h"
+#include "util/rational.h"
+#include "util/roundingmode.h"
+#include "util/string.h"
+
+namespace cvc5 {
+
+using namespace expr;
+using namespace kind;
+
+namespace test {
+
+class TestNodeBlackNodeSerializer : public TestNode
+{
+ protected:
+  std::vector<Node> roundTrip(const std::vector<Node>& nodes)
+  {
+    std::stringstream ss;
+    NodeSerializer::write(ss, {nodes});
+    std::vector<std::vector<Node>> lists = NodeSerializer::read(ss);
+    EXPECT_EQ(lists.size(), 1);
+    return lists[0];
+  }
+
+  /** The header written by this build */
+  std::string header()
+  {
+    std::stringstream ss;
+    NodeSerializer::write(ss, {});
+    // strip the end record, which consists of its tag and the empty count
+    std::string s = ss.str();
+    return s.substr(0, s.size() - 2);
+  }
+
+  /** Append v in the encoding of the binary format to s */
+  void appendUnsigned(std::string& s, uint64_t v)
+  {
+    while (v >= 0x80)
+    {
+      s.push_back(static_cast<char>((v & 0x7f) | 0x80));
+      v >>= 7;
+    }
+    s.push_back(static_cast<char>(v));
+  }
+
+  /** Append the record of the Boolean constant true to s */
+  void appendTrue(std::string& s)
+  {
+    appendUnsigned(s, 1);
+    appendUnsigned(s, CONST_BOOLEAN);
+    appendUnsigned(s, 1);
+  }
+};
+
+TEST_F(TestNodeBlackNodeSerializer, ground_terms)
+{
+  // ground terms are hash-consed, hence read back as the same nodes
+  Node one = d_nodeManager->mkConst(Rational(1));
+  Node half = d_nodeManager->mkConst(Rational(1, 2));
+  Node lt = d_nodeManager->mkNode(LT, d_nodeManager->mkNode(PLUS, one, half),
+                                  d_nodeManager->mkConst(Rational(-7, 3)));
+  Node bv = d_nodeManager->mkConst(BitVector(70, Integer("123456789012345")));
+  Node ext = theory::bv::utils::mkExtract(bv, 68, 3);
+  Node str = d_nodeManager->mkConst(String("ab\\u{10ffff}c", true));
+  Node len = d_nodeManager->mkNode(STRING_LENGTH, str);
+  Node rm = d_nodeManager->mkConst(RoundingMode::ROUND_TOWARD_ZERO);
+  Node pi = d_nodeManager->mkNullaryOperator(d_nodeManager->realType(), PI);
+  Node gt = d_nodeManager->mkNode(GT, pi, one);
+  std::vector<Node> nodes = {
+      d_nodeManager->mkConst(true), lt, ext, len, rm, gt};
+  ASSERT_EQ(roundTrip(nodes), nodes);
+  ASSERT_TRUE(roundTrip({}).empty());
+}
+
+TEST_F(TestNodeBlackNodeSerializer, lists)
+{
+  Node x = d_skolemManager->mkDummySkolem("x", d_nodeManager->integerType());
+  Node zero = d_nodeManager->mkConst(Rational(0));
+  Node geq = d_nodeManager->mkNode(GEQ, x, zero);
+  std::stringstream ss;
+  NodeSerializer::write(ss, {{x}, {}, {geq, x}});
+  std::vector<std::vector<Node>> res = NodeSerializer::read(ss);
+  ASSERT_EQ(res.size(), 3);
+  ASSERT_EQ(res[0].size(), 1);
+  ASSERT_TRUE(res[1].empty());
+  ASSERT_EQ(res[2].size(), 2);
+  // nodes are shared across lists
+  ASSERT_EQ(res[2][0][0], res[0][0]);
+  ASSERT_EQ(res[2][1], res[0][0]);
+  ASSERT_EQ(res[2][0][1], zero);
+}
+
+TEST_F(TestNodeBlackNodeSerializer, variables)
+{
+  TypeNode intType = d_nodeManager->integerType();
+  TypeNode fType = d_nodeManager->mkFunctionType(intType, intType);
+  Node x = d_skolemManager->mkDummySkolem(
+      "x", intType, "", NodeManager::SKOLEM_EXACT_NAME);
+  Node f = d_skolemManager->mkDummySkolem(
+      "f", fType, "", NodeManager::SKOLEM_EXACT_NAME);
+  Node fx = d_nodeManager->mkNode(APPLY_UF, f, x);
+  Node eq = d_nodeManager->mkNode(
+      EQUAL, fx, d_nodeManager->mkNode(PLUS, x, x));
+  Node v = d_nodeManager->mkBoundVar("v", intType);
+  Node forall = d_nodeManager->mkNode(
+      FORALL,
+      d_nodeManager->mkNode(BOUND_VAR_LIST, v),
+      d_nodeManager->mkNode(GEQ, d_nodeManager->mkNode(APPLY_UF, f, v), x));
+
+  std::vector<Node> res = roundTrip({eq, forall});
+  ASSERT_EQ(res.size(), 2);
+  // variables are fresh, but have the same names and types
+  Node rx = res[0][1][0];
+  Node rf = res[0][0].getOperator();
+  ASSERT_NE(rx, x);
+  ASSERT_EQ(rx.getKind(), SKOLEM);
+  ASSERT_EQ(rx.getType(), intType);
+  ASSERT_EQ(rf.getType(), fType);
+  std::stringstream ssx;
+  ssx << rx;
+  ASSERT_EQ(ssx.str(), "x");
+  // sharing is preserved, within and across nodes
+  ASSERT_EQ(res[0][1][1], rx);
+  ASSERT_EQ(res[0][0][0], rx);
+  ASSERT_EQ(res[1][1][1], rx);
+  ASSERT_EQ(res[1][1][0].getOperator(), rf);
+  // bound variables are fresh bound variables
+  Node rv = res[1][0][0];
+  ASSERT_EQ(rv.getKind(), BOUND_VARIABLE);
+  ASSERT_NE(rv, v);
+  ASSERT_EQ(res[1][1][0][0], rv);
+}
+
+TEST_F(TestNodeBlackNodeSerializer, uninterpreted_sorts)
+{
+  TypeNode u = d_nodeManager->mkSort("U");
+  Node a = d_skolemManager->mkDummySkolem("a", u);
+  Node b = d_skolemManager->mkDummySkolem("b", u);
+  std::vector<Node> res =
+      roundTrip({d_nodeManager->mkNode(EQUAL, a, b)});
+  ASSERT_EQ(res.size(), 1);
+  TypeNode ru = res[0][0].getType();
+  ASSERT_TRUE(ru.isSort());
+  ASSERT_NE(ru, u);
+  ASSERT_EQ(res[0][1].getType(), ru);
+}
+
+TEST_F(TestNodeBlackNodeSerializer, malformed)
+{
+  std::stringstream empty;
+  ASSERT_THROW(NodeSerializer::read(empty), Exception);
+  std::stringstream garbage("not serialized nodes");
+  ASSERT_THROW(NodeSerializer::read(garbage), Exception);
+
+  std::stringstream ss;
+  NodeSerializer::write(ss, {{d_nodeManager->mkConst(Rational(3))}});
+  std::string s = ss.str();
+  std::stringstream truncated(s.substr(0, s.size() - 1));
+  ASSERT_THROW(NodeSerializer::read(truncated), Exception);
+}
+
+TEST_F(TestNodeBlackNodeSerializer, validation)
+{
+  // a well-formed input, whose single list is the node (not true)
+  std::string valid = header();
+  appendTrue(valid);
+  appendUnsigned(valid, 1);
+  appendUnsigned(valid, NOT);
+  appendUnsigned(valid, 1);
+  appendUnsigned(valid, 0);
+  appendUnsigned(valid, 2);
+  appendUnsigned(valid, 1);
+  appendUnsigned(valid, 1);
+  appendUnsigned(valid, 1);
+  std::stringstream ssValid(valid);
+  std::vector<std::vector<Node>> res = NodeSerializer::read(ssValid);
+  ASSERT_EQ(res.size(), 1);
+  ASSERT_EQ(res[0].size(), 1);
+  ASSERT_EQ(res[0][0], d_nodeManager->mkConst(true).notNode());
+
+  // wrong number of children
+  std::string arity = header();
+  appendTrue(arity);
+  appendUnsigned(arity, 1);
+  appendUnsigned(arity, NOT);
+  appendUnsigned(arity, 2);
+  appendUnsigned(arity, 0);
+  appendUnsigned(arity, 0);
+  std::stringstream ssArity(arity);
+  ASSERT_THROW(NodeSerializer::read(ssArity), Exception);
+
+  // ill-typed
+  std::string typed = header();
+  appendTrue(typed);
+  appendUnsigned(typed, 1);
+  appendUnsigned(typed, PLUS);
+  appendUnsigned(typed, 2);
+  appendUnsigned(typed, 0);
+  appendUnsigned(typed, 0);
+  std::stringstream ssTyped(typed);
+  ASSERT_THROW(NodeSerializer::read(ssTyped), Exception);
+
+  // reference to a node that was not read yet
+  std::string forward = header();
+  appendUnsigned(forward, 1);
+  appendUnsigned(forward, NOT);
+  appendUnsigned(forward, 1);
+  appendUnsigned(forward, 0);
+  std::stringstream ssForward(forward);
+  ASSERT_THROW(NodeSerializer::read(ssForward), Exception);
+
+  // bit-vector type of size zero
+  std::string bv = header();
+  appendUnsigned(bv, 0);
+  appendUnsigned(bv, BITVECTOR_TYPE);
+  appendUnsigned(bv, 0);
+  std::stringstream ssBv(bv);
+  ASSERT_THROW(NodeSerializer::read(ssBv), Exception);
+
+  // invalid rounding mode
+  std::string rm = header();
+  appendUnsigned(rm, 1);
+  appendUnsigned(rm, CONST_ROUNDINGMODE);
+  appendUnsigned(rm, 100);
+  std::stringstream ssRm(rm);
+  ASSERT_THROW(NodeSerializer::read(ssRm), Exception);
+
+  // a kind that cannot be serialized
+  std::string unsupported = header();
+  appendUnsigned(unsupported, 1);
+  appendUnsigned(unsupported, NULL_EXPR);
+  std::stringstream ssUnsupported(unsupported);
+  ASSERT_THROW(NodeSerializer::read(ssUnsupported), Exception);
+}
+
+}  // namespace test
+}  // namespace cvc5
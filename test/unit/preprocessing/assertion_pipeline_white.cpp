@@ -0,0 +1,57 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2021 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * White box testing of preprocessing::AssertionPipeline.
+ */
+
+#include "expr/node_manager.h"
+#include "preprocessing/assertion_pipeline.h"
+#include "test_smt.h"
+
+namespace cvc5 {
+
+using namespace preprocessing;
+
+namespace test {
+
+class TestPPWhiteAssertionPipeline : public TestSmt
+{
+};
+
+TEST_F(TestPPWhiteAssertionPipeline, num_replaced)
+{
+  Node a = d_nodeManager->mkVar("a", d_nodeManager->booleanType());
+  Node b = d_nodeManager->mkVar("b", d_nodeManager->booleanType());
+  Node c = d_nodeManager->mkVar("c", d_nodeManager->booleanType());
+  AssertionPipeline ap;
+  ap.push_back(a);
+  ap.push_back(b);
+  ap.startRecordingReplaced();
+  ASSERT_EQ(ap.getNumReplaced(), 0u);
+  // replacing by the same assertion is not counted
+  ap.replace(0, a);
+  ASSERT_EQ(ap.getNumReplaced(), 0u);
+  // an assertion replaced twice is counted once
+  ap.replace(0, c);
+  ap.replace(0, a.notNode());
+  ASSERT_EQ(ap.getNumReplaced(), 1u);
+  ap.conjoin(1, c);
+  ASSERT_EQ(ap.getNumReplaced(), 2u);
+  // assertions added after startRecordingReplaced are not counted
+  ap.push_back(c);
+  ap.replace(2, b);
+  ASSERT_EQ(ap.getNumReplaced(), 2u);
+  ap.startRecordingReplaced();
+  ASSERT_EQ(ap.getNumReplaced(), 0u);
+  ap.replace(2, c);
+  ASSERT_EQ(ap.getNumReplaced(), 1u);
+}
+
+}  // namespace test
+}  // namespace cvc5
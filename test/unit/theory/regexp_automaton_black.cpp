@@ -0,0 +1,161 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2021 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Unit tests for automata of constant regular expressions.
+ */
+
+#include <memory>
+#include <vector>
+
+#include "expr/node.h"
+#include "expr/node_manager.h"
+#include "test_smt.h"
+#include "theory/strings/regexp_automaton.h"
+#include "theory/strings/regexp_entail.h"
+#include "util/regexp.h"
+#include "util/string.h"
+
+namespace cvc5 {
+
+using namespace kind;
+using namespace theory;
+using namespace theory::strings;
+
+namespace test {
+
+class TestTheoryBlackRegexpAutomaton : public TestSmt
+{
+ protected:
+  Node mkStr(const std::string& s)
+  {
+    return d_nodeManager->mkNode(STRING_TO_REGEXP,
+                                 d_nodeManager->mkConst(String(s)));
+  }
+
+  Node mkRange(const std::string& lo, const std::string& hi)
+  {
+    return d_nodeManager->mkNode(REGEXP_RANGE,
+                                 d_nodeManager->mkConst(String(lo)),
+                                 d_nodeManager->mkConst(String(hi)));
+  }
+
+  /**
+   * Check that the automaton for r agrees with the recursive evaluation of
+   * membership on each string of strs.
+   */
+  void checkAccepts(Node r, const std::vector<std::string>& strs)
+  {
+    std::unique_ptr<RegExpAutomaton> a = RegExpAutomaton::mkAutomaton(r);
+    ASSERT_NE(a, nullptr);
+    for (const std::string& str : strs)
+    {
+      String s(str);
+      ASSERT_EQ(a->accepts(s), RegExpEntail::testConstStringInRegExp(s, 0, r))
+          << str << " in " << r;
+    }
+  }
+
+  bool includes(Node r1, Node r2)
+  {
+    std::unique_ptr<RegExpAutomaton> a1 = RegExpAutomaton::mkAutomaton(r1);
+    std::unique_ptr<RegExpAutomaton> a2 = RegExpAutomaton::mkAutomaton(r2);
+    bool result = false;
+    EXPECT_TRUE(RegExpAutomaton::includes(*a1, *a2, result));
+    return result;
+  }
+};
+
+TEST_F(TestTheoryBlackRegexpAutomaton, accepts)
+{
+  Node sigma = d_nodeManager->mkNode(REGEXP_SIGMA);
+  Node digit = mkRange("0", "9");
+  Node digits = d_nodeManager->mkNode(REGEXP_PLUS, digit);
+  Node ab = d_nodeManager->mkNode(REGEXP_UNION, mkStr("a"), mkStr("b"));
+  // (a|b)*.abb
+  Node abb = d_nodeManager->mkNode(
+      REGEXP_CONCAT, d_nodeManager->mkNode(REGEXP_STAR, ab), mkStr("abb"));
+  // [0-9]+(.[0-9]+)?
+  Node num = d_nodeManager->mkNode(
+      REGEXP_CONCAT,
+      digits,
+      d_nodeManager->mkNode(
+          REGEXP_OPT,
+          d_nodeManager->mkNode(REGEXP_CONCAT, mkStr("."), digits)));
+  // (_ re.loop 2 3) (x.)
+  Node loop = d_nodeManager->mkNode(
+      REGEXP_LOOP,
+      d_nodeManager->mkConst(RegExpLoop(2, 3)),
+      d_nodeManager->mkNode(REGEXP_CONCAT, mkStr("x"), sigma));
+  std::vector<std::string> strs = {
+      "", "a", "abb", "babb", "abab", "aabbabb", "0", "12.5", "12.", ".5",
+      "1.2.3", "xa", "xaxb", "xaxbxc", "xaxbxcxd", "xaxby"};
+  checkAccepts(abb, strs);
+  checkAccepts(num, strs);
+  checkAccepts(d_nodeManager->mkNode(REGEXP_EMPTY), strs);
+  checkAccepts(mkStr(""), strs);
+  checkAccepts(d_nodeManager->mkNode(REGEXP_STAR, sigma), strs);
+
+  // loops are eliminated by the rewriter before evaluation, hence we check
+  // them directly
+  std::unique_ptr<RegExpAutomaton> aloop = RegExpAutomaton::mkAutomaton(loop);
+  ASSERT_FALSE(aloop->accepts(String("xa")));
+  ASSERT_TRUE(aloop->accepts(String("xaxb")));
+  ASSERT_TRUE(aloop->accepts(String("xaxbxc")));
+  ASSERT_FALSE(aloop->accepts(String("xaxbxcxd")));
+  ASSERT_FALSE(aloop->accepts(String("xaxby")));
+
+  ASSERT_TRUE(RegExpAutomaton::mkAutomaton(d_nodeManager->mkNode(REGEXP_EMPTY))
+                  ->isEmpty());
+  ASSERT_TRUE(RegExpAutomaton::mkAutomaton(mkRange("b", "a"))->isEmpty());
+  ASSERT_FALSE(RegExpAutomaton::mkAutomaton(num)->isEmpty());
+}
+
+TEST_F(TestTheoryBlackRegexpAutomaton, includes)
+{
+  Node sigma = d_nodeManager->mkNode(REGEXP_SIGMA);
+  Node sigmaStar = d_nodeManager->mkNode(REGEXP_STAR, sigma);
+  Node lower = mkRange("a", "z");
+  Node lowerStar = d_nodeManager->mkNode(REGEXP_STAR, lower);
+  Node abStar = d_nodeManager->mkNode(
+      REGEXP_STAR, d_nodeManager->mkNode(REGEXP_UNION, mkStr("a"), mkStr("b")));
+  // (ab)*.a
+  Node aba = d_nodeManager->mkNode(
+      REGEXP_CONCAT,
+      d_nodeManager->mkNode(REGEXP_STAR, mkStr("ab")),
+      mkStr("a"));
+  // a.(ba)*
+  Node aba2 = d_nodeManager->mkNode(
+      REGEXP_CONCAT,
+      mkStr("a"),
+      d_nodeManager->mkNode(REGEXP_STAR, mkStr("ba")));
+
+  ASSERT_TRUE(includes(sigmaStar, lowerStar));
+  ASSERT_FALSE(includes(lowerStar, sigmaStar));
+  ASSERT_TRUE(includes(lowerStar, abStar));
+  ASSERT_TRUE(includes(abStar, aba));
+  ASSERT_FALSE(includes(aba, abStar));
+  ASSERT_TRUE(includes(aba, aba2));
+  ASSERT_TRUE(includes(aba2, aba));
+}
+
+TEST_F(TestTheoryBlackRegexpAutomaton, unsupported)
+{
+  Node sigmaStar =
+      d_nodeManager->mkNode(REGEXP_STAR, d_nodeManager->mkNode(REGEXP_SIGMA));
+  Node x = d_skolemManager->mkDummySkolem("x", d_nodeManager->stringType());
+  ASSERT_EQ(RegExpAutomaton::mkAutomaton(
+                d_nodeManager->mkNode(REGEXP_COMPLEMENT, sigmaStar)),
+            nullptr);
+  ASSERT_EQ(RegExpAutomaton::mkAutomaton(
+                d_nodeManager->mkNode(STRING_TO_REGEXP, x)),
+            nullptr);
+}
+
+}  // namespace test
+}  // namespace cvc5
@@ -0,0 +1,103 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2021 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Unit tests for outward rounded double intervals.
+ */
+
+#include <limits>
+
+#include "test.h"
+#include "theory/arith/nl/icp/double_interval.h"
+#include "util/rational.h"
+
+namespace cvc5 {
+
+using namespace theory::arith::nl::icp;
+
+namespace test {
+
+class TestTheoryBlackArithDoubleInterval : public TestInternal
+{
+ protected:
+  /** Does i contain the rational r? */
+  bool contains(const DoubleInterval& i, const Rational& r)
+  {
+    double inf = std::numeric_limits<double>::infinity();
+    return (i.lower() == -inf || Rational::fromDouble(i.lower()).value() <= r)
+           && (i.upper() == inf || r <= Rational::fromDouble(i.upper()).value());
+  }
+};
+
+TEST_F(TestTheoryBlackArithDoubleInterval, exact)
+{
+  DoubleInterval a(1, 2);
+  DoubleInterval b(-3, 4);
+  ASSERT_EQ(a + b, DoubleInterval(-2, 6));
+  ASSERT_EQ(a - b, DoubleInterval(-3, 5));
+  ASSERT_EQ(a * b, DoubleInterval(-6, 8));
+  ASSERT_EQ(b / a, DoubleInterval(-3, 4));
+  ASSERT_EQ(a / b, DoubleInterval());
+  ASSERT_EQ(DoubleInterval(-2, 3).pow(2), DoubleInterval(0, 9));
+  ASSERT_EQ(DoubleInterval(-2, 3).pow(3), DoubleInterval(-8, 27));
+  ASSERT_EQ(DoubleInterval::fromRational(Rational(3, 4)),
+            DoubleInterval(0.75, 0.75));
+  ASSERT_EQ(DoubleInterval(1.5, 2.5).integralHull(), DoubleInterval(2, 2));
+  ASSERT_TRUE(DoubleInterval(1.2, 1.8).integralHull().isEmpty());
+}
+
+TEST_F(TestTheoryBlackArithDoubleInterval, outward)
+{
+  Rational third(1, 3);
+  DoubleInterval t = DoubleInterval::fromRational(third);
+  ASSERT_FALSE(t.isPoint());
+  ASSERT_TRUE(contains(t, third));
+  DoubleInterval one(1, 1);
+  DoubleInterval three(3, 3);
+  ASSERT_TRUE(contains(one / three, third));
+  ASSERT_TRUE(contains(t * three, Rational(1)));
+  ASSERT_TRUE(contains(t + t + t, Rational(1)));
+  DoubleInterval tenth = DoubleInterval::fromRational(Rational(1, 10));
+  ASSERT_TRUE(contains(tenth * tenth, Rational(1, 100)));
+  ASSERT_TRUE(contains(tenth.pow(3), Rational(1, 1000)));
+  // overflow yields an infinite bound
+  DoubleInterval big(1e308, 1e308);
+  ASSERT_EQ((big * DoubleInterval(10, 10)).upper(),
+            std::numeric_limits<double>::infinity());
+  ASSERT_EQ((big + big).lower(), std::numeric_limits<double>::max());
+}
+
+TEST_F(TestTheoryBlackArithDoubleInterval, infinite)
+{
+  double inf = std::numeric_limits<double>::infinity();
+  // quotients of two infinite bounds
+  ASSERT_EQ(DoubleInterval(-inf, 5) / DoubleInterval(-inf, -1),
+            DoubleInterval(-5, inf));
+  ASSERT_EQ(DoubleInterval(-inf, -1) / DoubleInterval(1, inf),
+            DoubleInterval(-inf, 0));
+  DoubleInterval all;
+  ASSERT_EQ(all / DoubleInterval(1, inf), all);
+  ASSERT_EQ(DoubleInterval(1, inf) / DoubleInterval(1, inf),
+            DoubleInterval(0, inf));
+  ASSERT_EQ(all * DoubleInterval(0, 0), DoubleInterval(0, 0));
+}
+
+TEST_F(TestTheoryBlackArithDoubleInterval, sqrt_inverse)
+{
+  DoubleInterval sq(4, 9);
+  ASSERT_EQ(sq.sqrtInverse(DoubleInterval()), DoubleInterval(-3, 3));
+  ASSERT_EQ(sq.sqrtInverse(DoubleInterval(0, 10)), DoubleInterval(2, 3));
+  ASSERT_TRUE(sq.sqrtInverse(DoubleInterval(-1, 1)).isEmpty());
+  ASSERT_TRUE(DoubleInterval(-2, -1).sqrtInverse(DoubleInterval()).isEmpty());
+  DoubleInterval root2 = DoubleInterval(2, 2).sqrtInverse(DoubleInterval(0, 2));
+  ASSERT_FALSE(root2.isPoint());
+  ASSERT_TRUE((root2 * root2).lower() <= 2 && 2 <= (root2 * root2).upper());
+}
+
+}  // namespace test
+}  // namespace cvc5
@@ -0,0 +1,175 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2021 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Unit tests for the columnar evaluation of terms on examples.
+ */
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "expr/node.h"
+#include "expr/node_manager.h"
+#include "test_smt.h"
+#include "theory/quantifiers/sygus/example_column_eval.h"
+#include "theory/rewriter.h"
+#include "util/bitvector.h"
+#include "util/rational.h"
+#include "util/string.h"
+
+namespace cvc5 {
+
+using namespace kind;
+using namespace theory;
+using namespace theory::quantifiers;
+
+namespace test {
+
+class TestTheoryBlackExampleColumnEval : public TestSmt
+{
+ protected:
+  /**
+   * Check that the columnar evaluation of n on the examples agrees with
+   * substitution and rewriting.
+   */
+  void checkEval(Node n,
+                 const std::vector<Node>& vars,
+                 const std::vector<std::vector<Node>>& examples)
+  {
+    ExampleColumnEval ce(vars, examples);
+    std::vector<int64_t> res;
+    ASSERT_TRUE(ce.evaluate(n, res)) << n;
+    ASSERT_EQ(res.size(), examples.size());
+    for (size_t j = 0, nex = examples.size(); j < nex; j++)
+    {
+      Node expected = Rewriter::rewrite(n.substitute(vars.begin(),
+                                                     vars.end(),
+                                                     examples[j].begin(),
+                                                     examples[j].end()));
+      ASSERT_EQ(ExampleColumnEval::mkValue(n.getType(), res[j]), expected)
+          << n << " on example " << j;
+    }
+  }
+
+  Node mkInt(int64_t v) { return d_nodeManager->mkConst(Rational(v)); }
+
+  Node mkBv(uint32_t w, uint64_t v)
+  {
+    return d_nodeManager->mkConst(BitVector(w, v));
+  }
+};
+
+TEST_F(TestTheoryBlackExampleColumnEval, integers)
+{
+  Node x = d_nodeManager->mkBoundVar("x", d_nodeManager->integerType());
+  Node y = d_nodeManager->mkBoundVar("y", d_nodeManager->integerType());
+  std::vector<Node> vars = {x, y};
+  std::vector<std::vector<Node>> examples = {{mkInt(0), mkInt(1)},
+                                             {mkInt(-5), mkInt(3)},
+                                             {mkInt(7), mkInt(7)},
+                                             {mkInt(100), mkInt(-42)}};
+  Node xpy = d_nodeManager->mkNode(PLUS, x, y, mkInt(2));
+  Node xty = d_nodeManager->mkNode(MULT, x, y);
+  Node cmp = d_nodeManager->mkNode(LEQ, xpy, xty);
+  checkEval(xpy, vars, examples);
+  checkEval(d_nodeManager->mkNode(MINUS, x, xty), vars, examples);
+  checkEval(d_nodeManager->mkNode(ABS, d_nodeManager->mkNode(UMINUS, x)),
+            vars,
+            examples);
+  checkEval(cmp, vars, examples);
+  checkEval(d_nodeManager->mkNode(ITE, cmp, xty, xpy), vars, examples);
+  Node neq = d_nodeManager->mkNode(NOT, d_nodeManager->mkNode(EQUAL, x, y));
+  checkEval(d_nodeManager->mkNode(AND, cmp, neq), vars, examples);
+}
+
+TEST_F(TestTheoryBlackExampleColumnEval, bitvectors)
+{
+  for (uint32_t w : {4u, 64u})
+  {
+    TypeNode bvt = d_nodeManager->mkBitVectorType(w);
+    Node x = d_nodeManager->mkBoundVar("x", bvt);
+    Node y = d_nodeManager->mkBoundVar("y", bvt);
+    std::vector<Node> vars = {x, y};
+    uint64_t max = w == 64 ? std::numeric_limits<uint64_t>::max()
+                           : (static_cast<uint64_t>(1) << w) - 1;
+    std::vector<std::vector<Node>> examples = {{mkBv(w, 0), mkBv(w, 1)},
+                                               {mkBv(w, 3), mkBv(w, 0)},
+                                               {mkBv(w, max), mkBv(w, 2)},
+                                               {mkBv(w, max - 1), mkBv(w, max)},
+                                               {mkBv(w, 5), mkBv(w, w)}};
+    for (Kind k : {BITVECTOR_ADD,
+                   BITVECTOR_SUB,
+                   BITVECTOR_MULT,
+                   BITVECTOR_AND,
+                   BITVECTOR_OR,
+                   BITVECTOR_XOR,
+                   BITVECTOR_SHL,
+                   BITVECTOR_LSHR,
+                   BITVECTOR_UDIV,
+                   BITVECTOR_UREM,
+                   BITVECTOR_COMP,
+                   BITVECTOR_ULT,
+                   BITVECTOR_UGE,
+                   BITVECTOR_SLT,
+                   BITVECTOR_SGE})
+    {
+      checkEval(d_nodeManager->mkNode(k, x, y), vars, examples);
+    }
+    checkEval(d_nodeManager->mkNode(BITVECTOR_NEG, x), vars, examples);
+    checkEval(d_nodeManager->mkNode(BITVECTOR_NOT, x), vars, examples);
+  }
+}
+
+TEST_F(TestTheoryBlackExampleColumnEval, threads)
+{
+  TypeNode bvt = d_nodeManager->mkBitVectorType(32);
+  Node x = d_nodeManager->mkBoundVar("x", bvt);
+  Node y = d_nodeManager->mkBoundVar("y", bvt);
+  std::vector<Node> vars = {x, y};
+  std::vector<std::vector<Node>> examples;
+  for (uint64_t j = 0; j < 5000; j++)
+  {
+    examples.push_back({mkBv(32, j * 7919), mkBv(32, j % 33)});
+  }
+  Node t = d_nodeManager->mkNode(
+      ITE,
+      d_nodeManager->mkNode(BITVECTOR_ULT, x, y),
+      d_nodeManager->mkNode(BITVECTOR_SHL, x, y),
+      d_nodeManager->mkNode(
+          BITVECTOR_ADD, d_nodeManager->mkNode(BITVECTOR_MULT, x, y), y));
+  ExampleColumnEval ce1(vars, examples);
+  ExampleColumnEval ce4(vars, examples, 4);
+  std::vector<int64_t> res1, res4;
+  ASSERT_TRUE(ce1.evaluate(t, res1));
+  ASSERT_TRUE(ce4.evaluate(t, res4));
+  ASSERT_EQ(res1, res4);
+}
+
+TEST_F(TestTheoryBlackExampleColumnEval, unsupported)
+{
+  Node x = d_nodeManager->mkBoundVar("x", d_nodeManager->integerType());
+  Node s = d_nodeManager->mkBoundVar("s", d_nodeManager->stringType());
+  std::vector<Node> vars = {x, s};
+  std::vector<std::vector<Node>> examples = {
+      {mkInt(std::numeric_limits<int64_t>::max()),
+       d_nodeManager->mkConst(String("a"))}};
+  ExampleColumnEval ce(vars, examples);
+  std::vector<int64_t> res;
+  // strings are not supported
+  ASSERT_FALSE(ce.evaluate(d_nodeManager->mkNode(STRING_LENGTH, s), res));
+  // integer division is not supported
+  ASSERT_FALSE(ce.evaluate(
+      d_nodeManager->mkNode(INTS_DIVISION_TOTAL, x, mkInt(2)), res));
+  // overflow
+  ASSERT_FALSE(ce.evaluate(d_nodeManager->mkNode(PLUS, x, mkInt(1)), res));
+  ASSERT_TRUE(ce.evaluate(d_nodeManager->mkNode(MINUS, x, mkInt(1)), res));
+}
+
+}  // namespace test
+}  // namespace cvc5
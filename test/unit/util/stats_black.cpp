@@ -16,6 +16,8 @@
 #include <fcntl.h>
 
 #include <ctime>
+#include <iomanip>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <thread>
@@ -97,5 +99,87 @@ TEST_F(TestUtilBlackStats, stats)
   ASSERT_EQ(reg.get("backedDoubleNoDec"), std::string("17"));
 #endif
 }
+
+TEST_F(TestUtilBlackStats, json_snapshot)
+{
+#ifdef CVC5_STATISTICS_ON
+  StatisticsRegistry reg(false);
+  HistogramStat<int64_t> hist = reg.registerHistogram<int64_t>("hist", false);
+  IntStat intstat = reg.registerInt("int", false);
+  reg.registerValue<std::string>("str", "a\"b", false);
+  // statistics that still have their default value are not printed
+  reg.registerInt("unused", false);
+  hist << 3;
+  intstat = 5;
+
+  std::stringstream ss;
+  reg.printJsonSnapshot(ss, 1);
+  ASSERT_NE(ss.str().find("\"query\":1,"), std::string::npos);
+  ASSERT_NE(ss.str().find(
+                "\"stats\":{\"hist\":{\"3\":1},\"int\":5,\"str\":\"a\\\"b\"}}\n"),
+            std::string::npos);
+
+  // only deltas are printed
+  hist << 3 << 4;
+  intstat++;
+  ss.str("");
+  reg.printJsonSnapshot(ss, 2);
+  ASSERT_NE(ss.str().find("\"query\":2,"), std::string::npos);
+  ASSERT_NE(ss.str().find("\"stats\":{\"hist\":{\"3\":1,\"4\":1},\"int\":1}}"),
+            std::string::npos);
+
+  ss.str("");
+  reg.printJsonSnapshot(ss, 2);
+  ASSERT_NE(ss.str().find("\"stats\":{}}"), std::string::npos);
+
+  // the formatting of the stream is restored
+  ss << std::scientific << std::setprecision(2);
+  reg.printJsonSnapshot(ss, 3);
+  ASSERT_EQ(ss.flags() & std::ios_base::floatfield, std::ios_base::scientific);
+  ASSERT_EQ(ss.precision(), 2);
+#endif
+}
+
+TEST_F(TestUtilBlackStats, json_snapshot_non_finite)
+{
+#ifdef CVC5_STATISTICS_ON
+  StatisticsRegistry reg(false);
+  ValueStat<double> nan = reg.registerValue<double>("nan", 0.0, false);
+  ValueStat<double> inf = reg.registerValue<double>("ninf", 0.0, false);
+  nan.set(std::numeric_limits<double>::quiet_NaN());
+  inf.set(-std::numeric_limits<double>::infinity());
+
+  // JSON has no numbers for NaN and infinity
+  std::stringstream ss;
+  reg.printJsonSnapshot(ss, 1);
+  ASSERT_NE(
+      ss.str().find("\"stats\":{\"nan\":\"nan\",\"ninf\":\"-inf\"}}"),
+      std::string::npos);
+
+  // unchanged non-finite values are not printed again
+  ss.str("");
+  reg.printJsonSnapshot(ss, 1);
+  ASSERT_NE(ss.str().find("\"stats\":{}}"), std::string::npos);
+#endif
+}
+
+TEST_F(TestUtilBlackStats, timer_get)
+{
+#ifdef CVC5_STATISTICS_ON
+  StatisticsRegistry reg(false);
+  TimerStat timer = reg.registerTimer("timer");
+  ASSERT_EQ(timer.get(), 0u);
+  {
+    CodeTimer ct(timer);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    // includes the running timer
+    ASSERT_GE(timer.get(), 5u);
+  }
+  uint64_t elapsed = timer.get();
+  ASSERT_GE(elapsed, 5u);
+  ASSERT_EQ(reg.get("timer"), std::to_string(elapsed) + "ms");
+#endif
+}
+
 }  // namespace test
 }  // namespace cvc5